@@ -0,0 +1,59 @@
+#include <DisRegRep/Container/PackedRegionfield.hpp>
+#include <DisRegRep/Container/Regionfield.hpp>
+
+#include <DisRegRep/Core/Bit.hpp>
+#include <DisRegRep/Core/Exception.hpp>
+
+#include <glm/vector_relational.hpp>
+
+#include <span>
+
+#include <algorithm>
+#include <execution>
+#include <ranges>
+
+using DisRegRep::Container::PackedRegionfield, DisRegRep::Container::Regionfield;
+
+using glm::greaterThan, glm::lessThanEqual;
+
+using std::span;
+using std::for_each, std::ranges::copy,
+	std::execution::par_unseq,
+	std::views::chunk, std::views::drop, std::views::iota, std::views::take, std::views::zip;
+
+void PackedRegionfield::pack(const Regionfield& regionfield) {
+	DRR_ASSERT(!regionfield.empty());
+
+	this->BitPerSample = Core::Bit::minimumBitPerSample(regionfield.span());
+	this->Extent = regionfield.extent();
+	this->RowStride = (this->Extent.y + this->BitPerSample.PackingFactor - 1U) >> this->BitPerSample.PackingFactorLog2;
+	this->Data.resize(this->Extent.x * this->RowStride);
+	this->RegionCount = regionfield.RegionCount;
+
+	//Each row is packed independently because rows are word-aligned.
+	const auto zip_data = zip(regionfield.range2d(), span(this->Data) | chunk(this->RowStride));
+	for_each(par_unseq, zip_data.cbegin(), zip_data.cend(), [&bps_result = this->BitPerSample](const auto io) {
+		const auto& [input, output] = io;
+		for (auto [word, samples] : zip(output, input | chunk(bps_result.PackingFactor))) [[likely]] {
+			word = Core::Bit::pack(samples, bps_result);
+		}
+	});
+}
+
+void PackedRegionfield::unpack(Regionfield& regionfield) const {
+	this->unpack(regionfield, DimensionType(0U), this->Extent);
+}
+
+void PackedRegionfield::unpack(Regionfield& regionfield, const DimensionType offset, const DimensionType extent) const {
+	DRR_ASSERT(glm::all(greaterThan(extent, DimensionType(0U))));
+	DRR_ASSERT(glm::all(lessThanEqual(offset + extent, this->Extent)));
+
+	regionfield.resize(extent);
+	regionfield.RegionCount = this->RegionCount;
+
+	const auto zip_data = zip(iota(offset.x, offset.x + extent.x), regionfield.range2d());
+	for_each(par_unseq, zip_data.cbegin(), zip_data.cend(), [this, offset_y = offset.y, extent_y = extent.y](const auto io) {
+		const auto& [row, output] = io;
+		copy(this->row(row) | drop(offset_y) | take(extent_y), output.begin());
+	});
+}
\ No newline at end of file
@@ -0,0 +1,174 @@
+#pragma once
+
+#include "Regionfield.hpp"
+
+#include <DisRegRep/Core/Bit.hpp>
+#include <DisRegRep/Core/UninitialisedAllocator.hpp>
+
+#include <span>
+#include <vector>
+
+#include <ranges>
+
+#include <limits>
+
+namespace DisRegRep::Container {
+
+/**
+ * @brief A @link Regionfield whose region identifiers are bit-packed in memory using the minimum number of bits per sample, such that a
+ * regionfield with few regions takes a fraction of the memory and bandwidth. Each row of the matrix starts at a new word, and elements
+ * are packed from MSB to LSB within a word, the same as how a regionfield is packed when serialised.
+ *
+ * Elements are decoded on the fly when iterating through the packed matrix.
+ *
+ * A packed regionfield can be splatted directly through a @link RegionfieldView of it, without being unpacked.
+ */
+class PackedRegionfield {
+public:
+
+	using ValueType = Regionfield::ValueType;
+	using WordType = ValueType; /**< Packed elements are stored in an integer of the same width as region identifier. */
+	using IndexType = Regionfield::IndexType;
+	using DimensionType = Regionfield::DimensionType;
+
+	using BitPerSampleResult = Core::Bit::BitPerSampleResult;
+
+private:
+
+	DimensionType Extent {};
+	IndexType RowStride {}; /**< Number of words per row. */
+	BitPerSampleResult BitPerSample { BitPerSampleResult::DataTypeTag<WordType>, std::numeric_limits<WordType>::digits };
+	std::vector<WordType, Core::UninitialisedAllocator<WordType>> Data;
+
+public:
+
+	using SizeType = decltype(Data)::size_type;
+
+private:
+
+	//Get the packed words of a row.
+	[[nodiscard]] constexpr std::span<const WordType> packedRow(const IndexType row) const noexcept {
+		return std::span(this->Data).subspan(row * this->RowStride, this->RowStride);
+	}
+
+public:
+
+	ValueType RegionCount {}; /**< @link Regionfield::RegionCount. */
+
+	/**
+	 * @brief Initialise an empty packed regionfield matrix.
+	 */
+	constexpr PackedRegionfield() = default;
+
+	PackedRegionfield(const PackedRegionfield&) = delete;
+
+	constexpr PackedRegionfield(PackedRegionfield&&) noexcept = default;
+
+	PackedRegionfield& operator=(const PackedRegionfield&) = delete;
+
+	constexpr PackedRegionfield& operator=(PackedRegionfield&&) noexcept = default;
+
+	constexpr ~PackedRegionfield() = default;
+
+	/**
+	 * @brief Pack a regionfield, replacing the current content. Memory is reused whenever possible.
+	 *
+	 * @param regionfield Regionfield to be packed. The number of bits per sample is the minimum required to store every region
+	 * identifier on it.
+	 *
+	 * @exception Exception When `regionfield` is empty.
+	 */
+	void pack(const Regionfield&);
+
+	/**
+	 * @brief Unpack the whole matrix into a regionfield.
+	 *
+	 * @param regionfield Regionfield to be unpacked to. It is resized to the extent of the packed matrix.
+	 */
+	void unpack(Regionfield&) const;
+
+	/**
+	 * @brief Unpack a window of the matrix into a regionfield.
+	 *
+	 * @param regionfield Regionfield to be unpacked to. It is resized to `extent`.
+	 * @param offset The offset of the window.
+	 * @param extent The extent of the window.
+	 *
+	 * @exception Exception When the window is empty or goes out of bound.
+	 */
+	void unpack(Regionfield&, DimensionType, DimensionType) const;
+
+	/**
+	 * @brief Get packed regionfield matrix extent.
+	 *
+	 * @return Width and height.
+	 */
+	[[nodiscard]] constexpr DimensionType extent() const noexcept {
+		return this->Extent;
+	}
+
+	/**
+	 * @brief Get the number of bits used to store each region identifier.
+	 *
+	 * @return @link BitPerSampleResult.
+	 */
+	[[nodiscard]] constexpr const BitPerSampleResult& bitPerSample() const noexcept {
+		return this->BitPerSample;
+	}
+
+	/**
+	 * @brief Get memory usage of the packed matrix.
+	 *
+	 * @return Number of bytes occupied by the packed words.
+	 */
+	[[nodiscard]] constexpr SizeType sizeByte() const noexcept {
+		return std::span(this->Data).size_bytes();
+	}
+
+	/**
+	 * @brief Check if the packed regionfield matrix is empty.
+	 *
+	 * @return True if empty.
+	 */
+	[[nodiscard]] constexpr bool empty() const noexcept {
+		return this->Data.empty();
+	}
+
+	/**
+	 * @brief Form a view of a row on the packed regionfield matrix, whose elements are unpacked on access.
+	 *
+	 * @param row Index of the row.
+	 *
+	 * @return A random access range of region identifiers on row `row`.
+	 */
+	[[nodiscard]] constexpr std::ranges::view auto row(const IndexType row) const noexcept {
+		using std::views::iota, std::views::transform;
+
+		const auto [bps, packing_factor, packing_factor_log2, sample_mask] = this->BitPerSample;
+		return iota(IndexType {}, this->Extent.y)
+			| transform([
+				word = this->packedRow(row).data(),
+				bps = static_cast<IndexType>(bps),
+				last = static_cast<IndexType>(packing_factor - 1U),
+				packing_factor_log2,
+				sample_mask
+			](const auto column) constexpr noexcept {
+				return static_cast<ValueType>(
+					(word[column >> packing_factor_log2] >> (last - (column & last)) * bps) & sample_mask);
+			});
+	}
+
+	/**
+	 * @brief Form a 2D view on the packed regionfield matrix, whose elements are unpacked on access.
+	 *
+	 * @return The 2D range of the packed regionfield, in the same shape as @link Regionfield::range2d.
+	 */
+	[[nodiscard]] constexpr std::ranges::view auto range2d() const noexcept {
+		using std::views::iota, std::views::transform;
+		return iota(IndexType {}, this->Extent.x)
+			| transform([this](const auto row) constexpr noexcept { return this->row(row); });
+	}
+
+};
+
+}
\ No newline at end of file
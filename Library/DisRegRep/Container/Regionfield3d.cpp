@@ -0,0 +1,28 @@
+#include <DisRegRep/Container/Regionfield3d.hpp>
+
+#include <DisRegRep/Core/Exception.hpp>
+#include <DisRegRep/Core/MdSpan.hpp>
+
+#include <glm/vector_relational.hpp>
+
+using DisRegRep::Container::Regionfield3d;
+
+using glm::greaterThan;
+
+void Regionfield3d::reserve(const DimensionType dim) {
+	DRR_ASSERT(glm::all(greaterThan(dim, DimensionType(0U))));
+
+	const MappingType reservation_mapping = Core::MdSpan::toExtent(dim);
+	this->Data.reserve(reservation_mapping.required_span_size());
+}
+
+void Regionfield3d::resize(const DimensionType dim) {
+	DRR_ASSERT(glm::all(greaterThan(dim, DimensionType(0U))));
+
+	this->Mapping = Core::MdSpan::toExtent(dim);
+	this->Data.resize(this->Mapping.required_span_size());
+}
+
+Regionfield3d::DimensionType Regionfield3d::extent() const noexcept {
+	return Core::MdSpan::toVector(this->Mapping.extents());
+}
\ No newline at end of file
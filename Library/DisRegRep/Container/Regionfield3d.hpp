@@ -0,0 +1,130 @@
+#pragma once
+
+#include <DisRegRep/Core/Type.hpp>
+#include <DisRegRep/Core/UninitialisedAllocator.hpp>
+
+#include <glm/vec3.hpp>
+
+#include <mdspan>
+#include <span>
+#include <vector>
+
+#include <type_traits>
+
+#include <cstdint>
+
+namespace DisRegRep::Container {
+
+/**
+ * @brief A volumetric regionfield is a 3D matrix $s_{W,H,D}$ of region identifiers, where $W$, $H$ and $D$ denote the width, height
+ * and depth of the matrix, respectively. The expression $s[r,c,l]$ is the region identifier at row $r$, column $c$ and layer $l$, and
+ * the layer has a stride of one.
+ *
+ * @link Regionfield for the 2D regionfield.
+ */
+class Regionfield3d {
+public:
+
+	using ValueType = Core::Type::RegionIdentifier;
+	using ConstValue = std::add_const_t<ValueType>;
+	using IndexType = std::uint_fast32_t;
+	using DimensionType = glm::vec<3U, IndexType>;
+
+	using ExtentType = std::dextents<IndexType, 3U>;
+	using LayoutType = std::layout_right;
+	using MdSpanType = std::mdspan<ValueType, ExtentType, LayoutType>;
+	using MappingType = MdSpanType::mapping_type;
+
+private:
+
+	MappingType Mapping;
+	std::vector<ValueType, Core::UninitialisedAllocator<ValueType>> Data;
+
+public:
+
+	/**
+	 * @brief @link Regionfield::RegionCount.
+	 */
+	ValueType RegionCount {};
+
+	/**
+	 * @brief Initialise an empty regionfield matrix.
+	 */
+	constexpr Regionfield3d() = default;
+
+	Regionfield3d(const Regionfield3d&) = delete;
+
+	constexpr Regionfield3d(Regionfield3d&&) noexcept = default;
+
+	Regionfield3d& operator=(const Regionfield3d&) = delete;
+
+	constexpr Regionfield3d& operator=(Regionfield3d&&) noexcept = default;
+
+	constexpr ~Regionfield3d() = default;
+
+	[[nodiscard]] constexpr bool operator==(const Regionfield3d&) const = default;
+
+	/**
+	 * @brief Reserve memory for the regionfield matrix so that it can hold at least as many number of elements as specified by the
+	 * dimension.
+	 *
+	 * @param dim The width, height and depth of the matrix.
+	 */
+	void reserve(DimensionType);
+
+	/**
+	 * @brief Resize the regionfield matrix. After this call returns, all existing contents become undefined regardless of whether
+	 * reallocation took place.
+	 *
+	 * @param dim The width, height and depth of the matrix.
+	 *
+	 * @exception Exception When any component of `dim` is not positive.
+	 */
+	void resize(DimensionType);
+
+	/**
+	 * @brief Get regionfield matrix extent.
+	 *
+	 * @return Width, height and depth.
+	 */
+	[[nodiscard]] DimensionType extent() const noexcept;
+
+	/**
+	 * @brief Get the linear size of the regionfield matrix.
+	 *
+	 * @return The total number of region identifiers stored.
+	 */
+	[[nodiscard]] constexpr IndexType size() const noexcept {
+		return this->Data.size();
+	}
+
+	/**
+	 * @brief Check if the regionfield matrix is empty.
+	 *
+	 * @return True if empty.
+	 */
+	[[nodiscard]] constexpr bool empty() const noexcept {
+		return this->Data.empty();
+	}
+
+	/**
+	 * @brief Get a multi-dimension view on the regionfield matrix.
+	 *
+	 * @return The mdspan of the regionfield.
+	 */
+	[[nodiscard]] constexpr auto mdspan(this auto& self) noexcept {
+		return std::mdspan(self.Data.data(), self.Mapping);
+	}
+
+	/**
+	 * @brief Get a 1D view on the regionfield matrix.
+	 *
+	 * @return The span of the regionfield.
+	 */
+	[[nodiscard]] constexpr auto span(this auto& self) noexcept {
+		return std::span(self.Data);
+	}
+
+};
+
+}
\ No newline at end of file
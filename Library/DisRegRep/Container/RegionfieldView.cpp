@@ -0,0 +1,41 @@
+#include <DisRegRep/Container/RegionfieldView.hpp>
+
+#include <DisRegRep/Core/Exception.hpp>
+#include <DisRegRep/Core/MdSpan.hpp>
+
+#include <glm/vector_relational.hpp>
+
+#include <array>
+
+using DisRegRep::Container::RegionfieldView;
+
+using glm::greaterThan, glm::lessThanEqual;
+
+using std::array;
+
+RegionfieldView RegionfieldView::crop(const DimensionType offset, const DimensionType extent) const {
+	DRR_ASSERT(this->strided());
+	DRR_ASSERT(glm::all(greaterThan(extent, DimensionType(0U))));
+	DRR_ASSERT(glm::all(lessThanEqual(offset + extent, this->extent())));
+
+	const MdSpanType view = this->mdspan();
+	const MappingType& mapping = view.mapping();
+	return {
+		MdSpanType(view.data_handle() + mapping(offset.x, offset.y), MappingType(Core::MdSpan::toExtent(extent), mapping.strides())),
+		this->RegionCount
+	};
+}
+
+RegionfieldView RegionfieldView::transpose() const {
+	DRR_ASSERT(this->strided());
+
+	const MdSpanType view = this->mdspan();
+	const MappingType& mapping = view.mapping();
+	return {
+		MdSpanType(view.data_handle(), MappingType(
+			ExtentType(mapping.extents().extent(1U), mapping.extents().extent(0U)),
+			array { mapping.stride(1U), mapping.stride(0U) }
+		)),
+		this->RegionCount
+	};
+}
\ No newline at end of file
@@ -0,0 +1,253 @@
+#pragma once
+
+#include "PackedRegionfield.hpp"
+#include "Regionfield.hpp"
+
+#include <DisRegRep/Core/MdSpan.hpp>
+
+#include <mdspan>
+#include <span>
+#include <variant>
+
+#include <functional>
+#include <ranges>
+
+#include <utility>
+
+namespace DisRegRep::Container {
+
+/**
+ * @brief A non-owning, read-only view of a regionfield matrix with arbitrary strides, such as a crop or a transpose of a
+ * @link Regionfield, or a matrix of region identifiers owned by another system. The expression $s[r,c]$ is the same as that of
+ * @link Regionfield, except the column is no longer required to have a stride of one.
+ *
+ * Alternatively, the view can be of a matrix in @link BlockedLayoutType, or of a @link PackedRegionfield whose elements are decoded
+ * on access. Such view is not @link strided, and can only be read through @link visitRange2d.
+ *
+ * A @link Regionfield or a @link PackedRegionfield is implicitly convertible to a view of itself, so every function that accepts a view
+ * also accepts either regionfield.
+ */
+class RegionfieldView {
+public:
+
+	using ValueType = Regionfield::ValueType;
+	using ConstValue = Regionfield::ConstValue;
+	using IndexType = Regionfield::IndexType;
+	using DimensionType = Regionfield::DimensionType;
+
+	using ExtentType = Regionfield::ExtentType;
+	using LayoutType = std::layout_stride;
+	using MdSpanType = std::mdspan<ConstValue, ExtentType, LayoutType>;
+	using MappingType = MdSpanType::mapping_type;
+
+	using BlockedLayoutType = Core::MdSpan::LayoutBlocked<8U>;
+	using BlockedMdSpanType = std::mdspan<ConstValue, ExtentType, BlockedLayoutType>;
+	using BlockedMappingType = BlockedMdSpanType::mapping_type;
+
+private:
+
+	std::variant<MdSpanType, BlockedMdSpanType, const PackedRegionfield*> View;
+
+public:
+
+	ValueType RegionCount {}; /**< @link Regionfield::RegionCount. */
+
+	/**
+	 * @brief Initialise an empty view.
+	 */
+	constexpr RegionfieldView() noexcept = default;
+
+	/**
+	 * @brief Initialise a view of a regionfield matrix.
+	 *
+	 * @param view A multi-dimension view on the regionfield matrix.
+	 * @param region_count @link RegionCount.
+	 */
+	constexpr RegionfieldView(const MdSpanType view, const ValueType region_count) noexcept :
+		View(view), RegionCount(region_count) { }
+
+	/**
+	 * @brief Initialise a view of a blocked regionfield matrix.
+	 *
+	 * @param view A multi-dimension view on the regionfield matrix in @link BlockedLayoutType.
+	 * @param region_count @link RegionCount.
+	 */
+	constexpr RegionfieldView(const BlockedMdSpanType view, const ValueType region_count) noexcept :
+		View(view), RegionCount(region_count) { }
+
+	/**
+	 * @brief Initialise a view of the whole regionfield.
+	 *
+	 * @param regionfield Regionfield to be viewed. The view is invalidated when `regionfield` is resized or destroyed.
+	 */
+	constexpr RegionfieldView(const Regionfield& regionfield) noexcept ://NOLINT(google-explicit-constructor, hicpp-explicit-conversions)
+		RegionfieldView(regionfield.mdspan(), regionfield.RegionCount) { }
+
+	/**
+	 * @brief Initialise a view of the whole packed regionfield.
+	 *
+	 * @param regionfield Packed regionfield to be viewed. The view is invalidated when `regionfield` is repacked or destroyed.
+	 */
+	//NOLINTNEXTLINE(google-explicit-constructor, hicpp-explicit-conversions)
+	constexpr RegionfieldView(const PackedRegionfield& regionfield) noexcept :
+		View(&regionfield), RegionCount(regionfield.RegionCount) { }
+
+	/**
+	 * @brief View a sub-matrix.
+	 *
+	 * @param offset The offset of the sub-matrix.
+	 * @param extent The extent of the sub-matrix.
+	 *
+	 * @return A view of the sub-matrix.
+	 *
+	 * @exception Exception When the view is not @link strided, or the sub-matrix is empty or goes out of bound.
+	 */
+	[[nodiscard]] RegionfieldView crop(DimensionType, DimensionType) const;
+
+	/**
+	 * @brief View the regionfield matrix transposed, by swapping extents and strides without copying.
+	 *
+	 * @return A transposed view.
+	 *
+	 * @exception Exception When the view is not @link strided.
+	 */
+	[[nodiscard]] RegionfieldView transpose() const;
+
+	/**
+	 * @brief Get regionfield matrix extent.
+	 *
+	 * @return Width and height.
+	 */
+	[[nodiscard]] constexpr DimensionType extent() const noexcept {
+		if (const auto* const packed = std::get_if<const PackedRegionfield*>(&this->View)) {
+			return (*packed)->extent();
+		}
+		if (const auto* const blocked = std::get_if<BlockedMdSpanType>(&this->View)) {
+			return Core::MdSpan::toVector(blocked->extents());
+		}
+		return Core::MdSpan::toVector(this->mdspan().extents());
+	}
+
+	/**
+	 * @brief Get the linear size of the regionfield matrix.
+	 *
+	 * @return The total number of region identifiers viewed.
+	 */
+	[[nodiscard]] constexpr IndexType size() const noexcept {
+		const DimensionType extent = this->extent();
+		return extent.x * extent.y;
+	}
+
+	/**
+	 * @brief Check if the regionfield matrix is empty.
+	 *
+	 * @return True if empty.
+	 */
+	[[nodiscard]] constexpr bool empty() const noexcept {
+		return this->size() == 0U;
+	}
+
+	/**
+	 * @brief Check if the view is a strided matrix of region identifiers, rather than a blocked matrix or a packed regionfield.
+	 *
+	 * @return True if the view has an mdspan.
+	 */
+	[[nodiscard]] constexpr bool strided() const noexcept {
+		return std::holds_alternative<MdSpanType>(this->View);
+	}
+
+	/**
+	 * @brief Get the multi-dimension view on the regionfield matrix.
+	 *
+	 * @return The mdspan of the regionfield. The behaviour is undefined if the view is not @link strided.
+	 */
+	[[nodiscard]] constexpr MdSpanType mdspan() const noexcept {
+		return *std::get_if<MdSpanType>(&this->View);
+	}
+
+	/**
+	 * @brief Check if elements of every row are adjacent in memory, like those of a @link Regionfield, such that the view can be formed by
+	 * @link rangeContiguous2d.
+	 *
+	 * @return True if the view is @link strided and the column has a stride of one.
+	 */
+	[[nodiscard]] constexpr bool contiguous() const noexcept {
+		return this->strided() && this->mdspan().stride(1U) == 1U;
+	}
+
+	/**
+	 * @brief Form a 2D view on the regionfield matrix.
+	 *
+	 * @return The 2D range of the regionfield, in the same shape as @link Regionfield::range2d. The behaviour is undefined if the view
+	 * is not @link strided.
+	 */
+	[[nodiscard]] constexpr std::ranges::view auto range2d() const noexcept {
+		using std::views::iota, std::views::stride, std::views::transform;
+		const MdSpanType view = this->mdspan();
+		return iota(IndexType {}, view.extent(0U))
+			| transform([view](const auto row) constexpr noexcept {
+				const IndexType column_stride = view.stride(1U);
+				return std::span(view.data_handle() + view.mapping()(row, IndexType {}), (view.extent(1U) - 1U) * column_stride + 1U)
+					| stride(column_stride);
+			});
+	}
+
+	/**
+	 * @brief Form a 2D view on the regionfield matrix whose rows are plain spans, avoiding strided iteration.
+	 *
+	 * @return The 2D range of the regionfield, in the same shape as @link Regionfield::range2d. The behaviour is undefined if the view
+	 * is not @link contiguous.
+	 */
+	[[nodiscard]] constexpr std::ranges::view auto rangeContiguous2d() const noexcept {
+		using std::views::iota, std::views::transform;
+		const MdSpanType view = this->mdspan();
+		return iota(IndexType {}, view.extent(0U))
+			| transform([view](const auto row) constexpr noexcept {
+				return std::span(view.data_handle() + view.mapping()(row, IndexType {}), view.extent(1U));
+			});
+	}
+
+	/**
+	 * @brief Form a 2D view on a blocked regionfield matrix, where each element is addressed by the blocked layout mapping.
+	 *
+	 * @return The 2D range of the regionfield, in the same shape as @link Regionfield::range2d. The behaviour is undefined if the view
+	 * is not of a matrix in @link BlockedLayoutType.
+	 */
+	[[nodiscard]] constexpr std::ranges::view auto rangeBlocked2d() const noexcept {
+		using std::views::iota, std::views::transform;
+		const BlockedMdSpanType view = *std::get_if<BlockedMdSpanType>(&this->View);
+		return iota(IndexType {}, view.extent(0U))
+			| transform([view](const auto row) constexpr noexcept {
+				return iota(IndexType {}, view.extent(1U))
+					| transform([view, row](const auto column) constexpr noexcept { return view[row, column]; });
+			});
+	}
+
+	/**
+	 * @brief Form a 2D view on the regionfield matrix using @link rangeContiguous2d whenever possible, otherwise @link range2d. If the
+	 * view is not @link strided, it is formed by @link rangeBlocked2d or @link PackedRegionfield::range2d.
+	 *
+	 * @tparam F Type of function.
+	 *
+	 * @param f Invoked with the 2D random access range of the regionfield, which has a different type in each case.
+	 *
+	 * @return The return value of `f`, which must be the same in all cases.
+	 */
+	template<typename F>
+	constexpr decltype(auto) visitRange2d(F&& f) const {
+		using std::invoke;
+		if (const auto* const packed = std::get_if<const PackedRegionfield*>(&this->View)) {
+			return invoke(std::forward<F>(f), (*packed)->range2d());
+		}
+		if (std::holds_alternative<BlockedMdSpanType>(this->View)) {
+			return invoke(std::forward<F>(f), this->rangeBlocked2d());
+		}
+		if (this->contiguous()) [[likely]] {
+			return invoke(std::forward<F>(f), this->rangeContiguous2d());
+		}
+		return invoke(std::forward<F>(f), this->range2d());
+	}
+
+};
+
+}
\ No newline at end of file
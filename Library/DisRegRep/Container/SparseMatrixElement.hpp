@@ -134,13 +134,37 @@ inline constexpr auto ToSparse =
 				| Core::View::Functional::MakeFromTuple<Basic<Value>>;
 		});
 
+/**
+ * @brief Convert values of a range of sparse matrix elements to another type, such as from single to half precision.
+ *
+ * @tparam T Target value type.
+ * @tparam Sparse Type of sparse range.
+ *
+ * @param sparse A range of sparse matrix element.
+ *
+ * @return A range of sparse matrix element whose value type is `T`.
+ */
+template<typename T>
+inline constexpr auto Cast = Core::View::RangeAdaptorClosure(
+	[]<std::ranges::viewable_range Sparse, typename SparseValue = std::ranges::range_value_t<Sparse>>
+	requires std::ranges::input_range<Sparse> && Is<SparseValue> && std::is_convertible_v<typename SparseValue::ValueType, T>
+	(Sparse&& sparse) static constexpr noexcept(Core::View::Trait::IsNothrowViewable<Sparse>) -> std::ranges::view auto {
+		return std::forward<Sparse>(sparse) | std::views::transform([](const SparseValue& element) static constexpr noexcept {
+			return Basic<T> {
+				.Identifier = element.Identifier,
+				.Value = static_cast<T>(element.Value)
+			};
+		});
+	});
+
 /**
  * @brief Normalise values in a range of dense or sparse matrix.
  *
  * @link Core::View::Arithmetic::Normalise
  *
  * @tparam Element Type of range of matrix element.
- * @tparam Factor Type of normalising value.
+ * @tparam Factor Type of normalising value. Values are converted to this type before normalisation, such that values stored in a
+ * lower precision are normalised in the precision of `Factor`.
  *
  * @param element Input range of matrix elements.
  * @param factor Normalising factor.
@@ -7,8 +7,8 @@
 #include <tuple>
 
 #include <algorithm>
-#include <execution>
 #include <functional>
+#include <ranges>
 
 #include <type_traits>
 #include <utility>
@@ -20,9 +20,9 @@ using SpltKn::Dense, SpltKn::Sparse, SpltKn::Internal_::DenseKernelBinaryOperato
 	DisRegRep::Container::SparseMatrixElement::Importance, DisRegRep::Core::Type::RegionIdentifier;
 
 using std::span, std::tie, std::apply;
-using std::for_each, std::execution::unseq,
-	std::ranges::fill;
-using std::plus, std::minus, std::invoke;
+using std::ranges::fill,
+	std::views::enumerate;
+using std::plus, std::minus, std::invoke, std::mem_fn;
 using std::is_same_v;
 
 namespace {
@@ -85,23 +85,68 @@ Sparse::SizeType Sparse::sizeByte() const noexcept {
 		tie(this->Importance_, this->Offset));
 }
 
-void Sparse::resize(const IndexType region_count) {
-	this->Offset.resize(region_count, Sparse::NoValueOffset);
+Sparse::OffsetContainerType::size_type Sparse::findOffset(const IndexType region_id) const noexcept {
+	//Region identifiers are mostly consecutive, so they are hashed to themselves.
+	const auto mask = this->Offset.size() - 1U;
+	auto slot = region_id & mask;
+	while (this->Offset[slot].Offset != Sparse::NoValueOffset && this->Offset[slot].Identifier != region_id) {
+		slot = (slot + 1U) & mask;
+	}
+	return slot;
+}
+
+void Sparse::eraseOffset(OffsetContainerType::size_type hole) noexcept {
+	const auto mask = this->Offset.size() - 1U;
+	for (auto slot = (hole + 1U) & mask;
+		this->Offset[slot].Offset != Sparse::NoValueOffset; slot = (slot + 1U) & mask) {
+		//An entry can only be moved into the hole if the hole is not before the slot it is hashed to.
+		if (const auto home = this->Offset[slot].Identifier & mask;
+			((slot - home) & mask) >= ((slot - hole) & mask)) {
+			this->Offset[hole] = this->Offset[slot];
+			hole = slot;
+		}
+	}
+	this->Offset[hole].Offset = Sparse::NoValueOffset;
+}
+
+void Sparse::rebuildOffset(const OffsetContainerType::size_type capacity) {
+	this->Offset.assign(capacity, OffsetEntry { .Identifier = {}, .Offset = Sparse::NoValueOffset });
+	for (const auto [offset, importance] : this->Importance_ | enumerate) {
+		this->Offset[this->findOffset(importance.Identifier)] = {
+			.Identifier = importance.Identifier,
+			.Offset = static_cast<OffsetType>(offset)
+		};
+	}
+}
+
+void Sparse::resize(IndexType) {
+	this->clear();
+	if (this->Offset.empty()) {
+		this->rebuildOffset(Sparse::MinimumOffsetCapacity);
+	}
 }
 
 void Sparse::clear() noexcept {
+	//Capacity of the hash table only depends on the number of regions that have ever been present in the kernel.
+	fill(this->Offset, OffsetEntry { .Identifier = {}, .Offset = Sparse::NoValueOffset });
 	this->Importance_.clear();
-	fill(this->Offset, Sparse::NoValueOffset);
 }
 
 void Sparse::increment(const ValueType& importance) {
 	const auto [region_id, value] = importance;
-	if (OffsetType& offset = this->Offset[region_id];
-		offset == Sparse::NoValueOffset) {
-		offset = this->Importance_.size();
+	if (auto slot = this->findOffset(region_id);
+		this->Offset[slot].Offset == Sparse::NoValueOffset) {
+		if (2U * (this->Importance_.size() + 1U) > this->Offset.size()) [[unlikely]] {
+			this->rebuildOffset(2U * this->Offset.size());
+			slot = this->findOffset(region_id);
+		}
+		this->Offset[slot] = {
+			.Identifier = region_id,
+			.Offset = static_cast<OffsetType>(this->Importance_.size())
+		};
 		this->Importance_.push_back(importance);
 	} else [[likely]] {
-		this->Importance_[offset].Value += value;
+		this->Importance_[this->Offset[slot].Offset].Value += value;
 	}
 }
 
@@ -111,23 +156,33 @@ void Sparse::increment(const IndexType region_id) {
 
 void Sparse::decrement(const ValueType& importance) {
 	const auto [region_id, value] = importance;
-	OffsetType& offset = this->Offset[region_id];
+	const auto slot = this->findOffset(region_id);
+	const OffsetType offset = this->Offset[slot].Offset;
 	assert(offset != Sparse::NoValueOffset);
 
-	if (const auto erasing_value_it = this->Importance_.begin() + offset;
-		erasing_value_it->Value <= value) {
-		//Need to fully remove this value from the array and update offsets of all following entries.
-		//i.e. maintaining sparsity.
-		const auto following_value_it = this->Importance_.erase(erasing_value_it);
-		for_each(unseq, following_value_it, this->Importance_.end(),
-			[&offset = this->Offset](const auto& entry) constexpr noexcept { --offset[entry.Identifier]; });
+	if (ValueType& erasing_value = this->Importance_[offset];
+		erasing_value.Value <= value) {
+		//Need to fully remove this value from the array, i.e. maintaining sparsity.
+		//Order is not preserved, so move the last entry to fill the hole, then only its offset needs to be updated.
+		const ValueType& last_value = this->Importance_.back();
+		this->Offset[this->findOffset(last_value.Identifier)].Offset = offset;
+		erasing_value = last_value;
+		this->Importance_.pop_back();
 
-		offset = Sparse::NoValueOffset;
+		this->eraseOffset(slot);
 	} else [[likely]] {
-		erasing_value_it->Value -= value;
+		erasing_value.Value -= value;
 	}
 }
 
 void Sparse::decrement(const IndexType region_id) {
 	this->decrement(makeSingleImportance(region_id));
+}
+
+void Sparse::sort() noexcept {
+	std::ranges::sort(this->Importance_, {}, mem_fn(&ValueType::Identifier));
+	//Every region stays in the same slot of the hash table, only its offset into the importance array is changed.
+	for (const auto [offset, importance] : this->Importance_ | enumerate) {
+		this->Offset[this->findOffset(importance.Identifier)].Offset = static_cast<OffsetType>(offset);
+	}
 }
\ No newline at end of file
@@ -2,8 +2,10 @@
 
 #include "SparseMatrixElement.hpp"
 
+#include <DisRegRep/Core/Exception.hpp>
 #include <DisRegRep/Core/Type.hpp>
 
+#include <array>
 #include <span>
 #include <vector>
 
@@ -17,6 +19,7 @@
 #include <type_traits>
 
 #include <cassert>
+#include <cstddef>
 
 /**
  * @brief Stores region importance of the convolution kernel for splatting region features.
@@ -261,8 +264,10 @@ public:
 };
 
 /**
- * @brief A sparse kernel collects two contiguous arrays, one stores sparse importance entries, the other stores offsets into the sparse
- * array given region identifier.
+ * @brief A sparse kernel collects two contiguous arrays, one stores sparse importance entries, the other is a hash table that stores
+ * offsets into the sparse array given region identifier. Entries are unordered, such that a region can be removed in constant time by
+ * moving the last entry into its place. Memory of both arrays scales with the number of regions present in the kernel rather than the
+ * number of regions on the regionfield.
  */
 class Sparse {
 public:
@@ -273,15 +278,36 @@ public:
 
 private:
 
+	/**
+	 * @brief A slot in the open addressing hash table of offsets.
+	 */
+	struct OffsetEntry {
+
+		IndexType Identifier;
+		OffsetType Offset;
+
+	};
+
 	using ValueContainerType = std::vector<ValueType>;
-	using OffsetContainerType = std::vector<OffsetType>;
+	using OffsetContainerType = std::vector<OffsetEntry>;
 
-	//A special offset to indicate a region identifier does not exist in the kernel.
+	//A special offset to indicate a slot in the hash table is empty.
 	static constexpr auto NoValueOffset = std::numeric_limits<OffsetType>::max();
+	//Capacity of the hash table is always a power of two, and it is kept at most half full.
+	static constexpr OffsetContainerType::size_type MinimumOffsetCapacity = 16U;
 
 	ValueContainerType Importance_;
 	OffsetContainerType Offset;
 
+	//Find the slot of a region in the hash table, or the empty slot where it should be inserted.
+	[[nodiscard]] OffsetContainerType::size_type findOffset(IndexType) const noexcept;
+
+	//Remove an entry from the hash table, and shift the following entries in its probe sequence backwards to fill the hole.
+	void eraseOffset(OffsetContainerType::size_type) noexcept;
+
+	//Allocate a hash table of a given capacity, and insert every entry of the importance array into it.
+	void rebuildOffset(OffsetContainerType::size_type);
+
 	//Modify some regions by some amount.
 	template<
 		SparseImportanceRange Importance,
@@ -338,6 +364,8 @@ public:
 	/**
 	 * @brief Resize sparse kernel.
 	 *
+	 * @note Memory is allocated on demand as regions are added, so this only clears the kernel.
+	 *
 	 * @param region_count The maximum number of region identifiers to be held by this kernel.
 	 */
 	void resize(IndexType);
@@ -349,6 +377,8 @@ public:
 
 	/**
 	 * @brief Get a constant view into the sparse kernel.
+	 *
+	 * @note Entries are not in any particular order unless @link Sparse::sort is called.
 	 * 
 	 * @return The sparse kernel view.
 	 */
@@ -356,6 +386,12 @@ public:
 		return std::span(this->Importance_);
 	}
 
+	/**
+	 * @brief Sort entries in ascending order of region identifier. Every region keeps its importance, so the kernel can be modified as
+	 * usual afterwards, but entries become unordered again once a region is removed.
+	 */
+	void sort() noexcept;
+
 	/**
 	 * @brief Increment importance of a region by a given amount specified in a sparse importance matrix element.
 	 *
@@ -410,11 +446,219 @@ public:
 
 };
 
+/**
+ * @brief A fixed kernel is a dense kernel whose capacity is known at compile time. Importance is held in an array within the kernel
+ * rather than in a separately allocated memory, such that the compiler is able to keep the whole kernel in registers, and clearing the
+ * kernel is a fixed-size fill.
+ *
+ * @tparam N Maximum number of regions held by the kernel.
+ */
+template<std::size_t N>
+requires(N > 0U)
+class Fixed {
+public:
+
+	using ValueType = Internal_::DenseValueType;
+	using IndexType = Core::Type::RegionIdentifier;
+
+	static constexpr std::size_t Capacity = N;
+
+private:
+
+	using ContainerType = std::array<ValueType, Capacity>;
+
+	ContainerType Importance_ {};
+	IndexType Size {};
+
+	//Modify all regions by some amount.
+	template<Internal_::DenseKernelBinaryOperator Op, DenseImportanceRange Importance>
+	constexpr void modify(Op op, Importance&& importance) {
+		using std::ranges::transform;
+		transform(this->Importance_ | std::views::take(this->Size), std::forward<Importance>(importance), this->Importance_.begin(),
+			std::move(op));
+	}
+
+	//Modify some regions by some amount.
+	template<SparseImportanceRange Importance>
+	constexpr void modify(Importance&& importance, Internal_::KernelModifier<Fixed&, Importance> auto modifier) {
+		Internal_::modify(*this, std::forward<Importance>(importance), std::move(modifier));
+	}
+
+public:
+
+	using SizeType = std::size_t;
+
+	constexpr Fixed() noexcept = default;
+
+	Fixed(const Fixed&) = delete;
+
+	Fixed(Fixed&&) = delete;
+
+	Fixed& operator=(const Fixed&) = delete;
+
+	Fixed& operator=(Fixed&&) = delete;
+
+	constexpr ~Fixed() = default;
+
+	/**
+	 * @brief Get size of the fixed kernel.
+	 *
+	 * @return Fixed kernel size.
+	 */
+	[[nodiscard]] constexpr IndexType size() const noexcept {
+		return this->Size;
+	}
+
+	/**
+	 * @brief Get size of the fixed kernel in bytes.
+	 *
+	 * @return Fixed kernel size in bytes, which is always that of its full capacity.
+	 */
+	[[nodiscard]] constexpr SizeType sizeByte() const noexcept {
+		return sizeof(ContainerType);
+	}
+
+	/**
+	 * @brief Check if the fixed kernel is empty.
+	 *
+	 * @return True if empty.
+	 */
+	[[nodiscard]] constexpr bool empty() const noexcept {
+		return this->Size == 0U;
+	}
+
+	/**
+	 * @brief Resize fixed kernel. Importance of regions added by the resize is zero.
+	 *
+	 * @param region_count The maximum number of region identifiers to be held by this kernel, which must not exceed the capacity.
+	 */
+	void resize(const IndexType region_count) {
+		DRR_ASSERT(region_count <= Capacity);
+		if (region_count > this->Size) {
+			std::ranges::fill(this->Importance_.begin() + this->Size, this->Importance_.begin() + region_count, ValueType {});
+		}
+		this->Size = region_count;
+	}
+
+	/**
+	 * @brief Clear all contents in the kernel and reset importance of all regions to zero. Array size is unaffected.
+	 */
+	constexpr void clear() noexcept {
+		this->Importance_.fill(ValueType {});
+	}
+
+	/**
+	 * @brief Get a constant view into the fixed kernel.
+	 *
+	 * @return The fixed kernel view.
+	 */
+	[[nodiscard]] constexpr auto span() const noexcept {
+		return std::span(this->Importance_).first(this->Size);
+	}
+
+	/**
+	 * @brief Increment the importance of a region by one.
+	 *
+	 * @param region_id Identifier of region whose importance is to be incremented.
+	 */
+	constexpr void increment(const IndexType region_id) noexcept {
+		this->Importance_[region_id]++;
+	}
+
+	/**
+	 * @brief Increment the importance of a region by some amount.
+	 *
+	 * @param importance A sparse importance matrix element used for incrementation.
+	 */
+	constexpr void increment(const SparseMatrixElement::Importance& importance) noexcept {
+		const auto [region_id, value] = importance;
+		this->Importance_[region_id] += value;
+	}
+
+	/**
+	 * @brief Increment the importance of all regions by some amount.
+	 *
+	 * @tparam Importance A range of importance for region at each index.
+	 *
+	 * @param importance The size of this range must be no less than the size of the kernel.
+	 */
+	template<DenseImportanceRange Importance>
+	constexpr void increment(Importance&& importance) {
+		this->modify(std::plus {}, std::forward<Importance>(importance));
+	}
+
+	/**
+	 * @brief Increment the importance of some regions by some amount.
+	 *
+	 * @tparam Importance A range of sparse importance matrix element.
+	 *
+	 * @param importance Each specifies the region identifier and the amount of importance to increment.
+	 */
+	template<SparseImportanceRange Importance>
+	constexpr void increment(Importance&& importance) {
+		this->modify(std::forward<Importance>(importance),
+			std::mem_fn(static_cast<void (Fixed::*)(const SparseMatrixElement::Importance&)>(&Fixed::increment)));
+	}
+
+	/**
+	 * @brief Decrement the importance of a region by one.
+	 *
+	 * @param region_id Identifier of region whose importance is to be decremented.
+	 */
+	constexpr void decrement(const IndexType region_id) noexcept {
+		assert(this->Importance_[region_id] >= 1U);
+		this->Importance_[region_id]--;
+	}
+
+	/**
+	 * @brief Decrement the importance of a region by some amount.
+	 *
+	 * @param importance A sparse importance matrix element used for decrementation.
+	 */
+	constexpr void decrement(const SparseMatrixElement::Importance& importance) noexcept {
+		const auto [region_id, value] = importance;
+		assert(this->Importance_[region_id] >= value);
+		this->Importance_[region_id] -= value;
+	}
+
+	/**
+	 * @brief Decrement the importance of all regions by some amount.
+	 *
+	 * @tparam Importance A range of importance for region at each index.
+	 *
+	 * @param importance The size of this range must be no less than the size of the kernel.
+	 */
+	template<DenseImportanceRange Importance>
+	constexpr void decrement(Importance&& importance) {
+		this->modify(std::minus {}, std::forward<Importance>(importance));
+	}
+
+	/**
+	 * @brief Decrement the importance of some regions by some amount.
+	 *
+	 * @tparam Importance A range of sparse importance matrix element.
+	 *
+	 * @param importance Each specifies the region identifier and the amount of importance to decrement.
+	 */
+	template<SparseImportanceRange Importance>
+	constexpr void decrement(Importance&& importance) {
+		this->modify(std::forward<Importance>(importance),
+			std::mem_fn(static_cast<void (Fixed::*)(const SparseMatrixElement::Importance&)>(&Fixed::decrement)));
+	}
+
+};
+
+/**
+ * `Kn` is a fixed kernel of any capacity.
+ */
+template<typename Kn>
+concept IsFixed = std::is_same_v<Kn, Fixed<Kn::Capacity>>;
+
 /**
  * `Kn` is one of the valid splat kernel.
  */
 template<typename Kn>
-concept Is = std::is_same_v<Kn, Dense> || std::is_same_v<Kn, Sparse>;
+concept Is = std::is_same_v<Kn, Dense> || std::is_same_v<Kn, Sparse> || IsFixed<Kn>;
 
 /**
  * @brief Convert a splat kernel of region importance to mask by normalisation.
@@ -428,4 +672,25 @@ concept Is = std::is_same_v<Kn, Dense> || std::is_same_v<Kn, Sparse>;
 	return kernel.span() | SparseMatrixElement::Normalise(norm_factor);
 }
 
+/**
+ * @brief Convert a splat kernel of region importance to mask by normalisation, optionally in ascending order of region identifier.
+ *
+ * @tparam Kn Type of splat kernel.
+ *
+ * @param kernel Splat kernel to be normalised. Only a @link Sparse kernel is not already in order, and it is sorted in place.
+ * @param norm_factor Normalisation factor.
+ * @param sorted True to emit the mask in order.
+ *
+ * @return A splat kernel of region mask.
+ */
+template<Is Kn>
+[[nodiscard]] constexpr std::ranges::view auto toMask(Kn& kernel, const Core::Type::RegionMask norm_factor, const bool sorted) noexcept {
+	if constexpr (std::is_same_v<Kn, Sparse>) {
+		if (sorted) {
+			kernel.sort();
+		}
+	}
+	return toMask(std::as_const(kernel), norm_factor);
+}
+
 }
\ No newline at end of file
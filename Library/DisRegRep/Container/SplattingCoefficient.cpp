@@ -1,27 +1,40 @@
 #include <DisRegRep/Container/SplattingCoefficient.hpp>
 
 #include <DisRegRep/Core/Exception.hpp>
+#include <DisRegRep/Core/HalfPrecision.hpp>
 #include <DisRegRep/Core/MdSpan.hpp>
 #include <DisRegRep/Core/Type.hpp>
 
 #include <glm/vector_relational.hpp>
 
+#include <array>
 #include <span>
 #include <tuple>
+#include <vector>
 
 #include <algorithm>
 #include <execution>
 #include <functional>
+#include <numeric>
+#include <ranges>
+
+#include <concepts>
+#include <type_traits>
+
+#include <cstdint>
 
 namespace SpltCoef = DisRegRep::Container::SplattingCoefficient;
-using SpltCoef::BasicDense, SpltCoef::BasicSparse;
-using DisRegRep::Core::Type::RegionImportance, DisRegRep::Core::Type::RegionMask;
+using SpltCoef::BasicDense, SpltCoef::BasicPlanar, SpltCoef::BasicSparse, SpltCoef::BasicCompactSparse, SpltCoef::BasicTopK;
+using DisRegRep::Core::Type::RegionImportance, DisRegRep::Core::Type::RegionMask,
+	DisRegRep::Core::HalfPrecision::Float16, DisRegRep::Core::HalfPrecision::BFloat16;
 
-using std::span,
+using std::array, std::span, std::vector,
 	std::tie, std::apply;
-using std::for_each, std::all_of,
-	std::execution::par_unseq;
-using std::mem_fn;
+using std::for_each, std::all_of, std::copy, std::transform, std::transform_inclusive_scan,
+	std::execution::par_unseq,
+	std::views::iota, std::views::pairwise, std::views::zip;
+using std::mem_fn, std::plus;
+using std::floating_point, std::unsigned_integral, std::is_same_v;
 
 template<typename V>
 typename BasicDense<V>::Dimension3Type BasicDense<V>::extent() const noexcept {
@@ -41,6 +54,26 @@ void BasicDense<V>::resize(const Dimension3Type dim) {
 	this->DenseMatrix.resize(this->Mapping.required_span_size());
 }
 
+template<typename V>
+typename BasicPlanar<V>::Dimension3Type BasicPlanar<V>::extent() const noexcept {
+	return Core::MdSpan::toVector(this->Mapping.extents());
+}
+
+template<typename V>
+typename BasicPlanar<V>::SizeType BasicPlanar<V>::sizeByte() const noexcept {
+	return span(this->PlanarMatrix).size_bytes();
+}
+
+template<typename V>
+void BasicPlanar<V>::resize(const Dimension3Type dim) {
+	DRR_ASSERT(glm::all(glm::greaterThan(dim, Dimension3Type(0U))));
+
+	//Row-major within a plane, and each region is a plane.
+	const IndexType plane_size = dim.x * dim.y;
+	this->Mapping = MappingType(Core::MdSpan::toExtent(dim), array<IndexType, 3U> { dim.y, 1U, plane_size });
+	this->PlanarMatrix.resize(plane_size * dim.z);
+}
+
 template<typename V>
 void BasicSparse<V>::sort() {
 	using std::ranges::sort;
@@ -81,11 +114,137 @@ void BasicSparse<V>::resize(const Dimension3Type dim) {
 	this->SparseMatrix.clear();
 }
 
+template<floating_point V, typename S>
+requires(is_same_v<S, V> || unsigned_integral<S>)
+void BasicCompactSparse<V, S>::sort() {
+	const auto pairwise_offset = this->Offset | pairwise;
+	for_each(par_unseq, pairwise_offset.begin(), pairwise_offset.end(), [this](const auto offset) {
+		const auto [prev, next] = offset;
+		//Identifiers and values are swapped together.
+		std::ranges::sort(zip(span(this->Identifier).subspan(prev, next - prev), span(this->Value).subspan(prev, next - prev)), {},
+			[](const auto& element) static constexpr noexcept { return std::get<0U>(element); });
+	});
+}
+
+template<floating_point V, typename S>
+requires(is_same_v<S, V> || unsigned_integral<S>)
+bool BasicCompactSparse<V, S>::isSorted() const {
+	const auto pairwise_offset = this->Offset | pairwise;
+	return all_of(par_unseq, pairwise_offset.begin(), pairwise_offset.end(), [this](const auto offset) {
+		const auto [prev, next] = offset;
+		return std::ranges::is_sorted(span(this->Identifier).subspan(prev, next - prev));
+	});
+}
+
+template<floating_point V, typename S>
+requires(is_same_v<S, V> || unsigned_integral<S>)
+typename BasicCompactSparse<V, S>::Dimension2Type BasicCompactSparse<V, S>::extent() const noexcept {
+	return Core::MdSpan::toVector(this->OffsetMapping.extents());
+}
+
+template<floating_point V, typename S>
+requires(is_same_v<S, V> || unsigned_integral<S>)
+typename BasicCompactSparse<V, S>::SizeType BasicCompactSparse<V, S>::sizeByte() const noexcept {
+	return apply([](const auto&... matrix) static constexpr noexcept { return (span(matrix).size_bytes() + ...); },
+		tie(this->Offset, this->Identifier, this->Value));
+}
+
+template<floating_point V, typename S>
+requires(is_same_v<S, V> || unsigned_integral<S>)
+void BasicCompactSparse<V, S>::resize(const Dimension3Type dim) {
+	//Region count is unused in a compact sparse matrix.
+	const Dimension2Type dim_wh = dim;
+	DRR_ASSERT(glm::all(glm::greaterThan(dim_wh, Dimension2Type(0U))));
+
+	this->OffsetMapping = Core::MdSpan::toExtent(dim_wh);
+	this->Offset.resize(this->sizeOffset());
+	this->Identifier.clear();
+	this->Value.clear();
+}
+
+template<floating_point V, std::uint_fast8_t K>
+requires(K >= 1U && K <= 4U)
+typename BasicTopK<V, K>::Dimension2Type BasicTopK<V, K>::extent() const noexcept {
+	return Core::MdSpan::toVector(this->Mapping.extents());
+}
+
+template<floating_point V, std::uint_fast8_t K>
+requires(K >= 1U && K <= 4U)
+typename BasicTopK<V, K>::SizeType BasicTopK<V, K>::sizeByte() const noexcept {
+	return apply([](const auto&... matrix) static constexpr noexcept { return (span(matrix).size_bytes() + ...); },
+		tie(this->Identifier, this->Value));
+}
+
+template<floating_point V, std::uint_fast8_t K>
+requires(K >= 1U && K <= 4U)
+void BasicTopK<V, K>::resize(const Dimension3Type dim) {
+	//Region count is unused in a top-K matrix.
+	const Dimension2Type dim_wh = dim;
+	DRR_ASSERT(glm::all(glm::greaterThan(dim_wh, Dimension2Type(0U))));
+
+	this->Mapping = Core::MdSpan::toExtent(dim_wh);
+	const auto size = this->Mapping.required_span_size() * Capacity;
+	this->Identifier.resize(size);
+	this->Value.resize(size);
+}
+
+template<typename V>
+typename BasicSparse<V>::SizeType BasicSparse<V>::Segment::sizeByte() const noexcept {
+	return apply([](const auto&... matrix) static constexpr noexcept { return (span(matrix).size_bytes() + ...); },
+		tie(this->Offset, this->SparseMatrix));
+}
+
+template<typename V>
+void BasicSparse<V>::Segment::resize(const IndexType count) {
+	DRR_ASSERT(count > 0U);
+
+	this->Offset.resize(count + 1U);
+	this->SparseMatrix.clear();
+}
+
+template<typename V>
+void BasicSparse<V>::assemble(const span<const Segment> segment) {
+	//Position of the first element and the first value of each segment in the sparse matrix, with the total at the end.
+	vector<IndexType> element_base(segment.size() + 1U);
+	vector<OffsetType> value_base(segment.size() + 1U);
+	transform_inclusive_scan(segment.begin(), segment.end(), element_base.begin() + 1U, plus {}, mem_fn(&Segment::count));
+	transform_inclusive_scan(segment.begin(), segment.end(), value_base.begin() + 1U, plus {},
+		[](const auto& current_segment) static noexcept -> OffsetType { return current_segment.SparseMatrix.size(); });
+	DRR_ASSERT(element_base.back() == this->OffsetMapping.required_span_size());
+
+	this->SparseMatrix.resize(value_base.back());
+	const auto segment_index = iota(std::size_t {}, segment.size());
+	for_each(par_unseq, segment_index.begin(), segment_index.end(), [this, segment, &element_base, &value_base](const auto i) {
+		const auto& [offset, sparse_matrix] = segment[i];
+		const OffsetType current_value_base = value_base[i];
+
+		copy(sparse_matrix.cbegin(), sparse_matrix.cend(), this->SparseMatrix.begin() + current_value_base);
+		//The first offset of every segment is zero, and is taken care of by the previous segment.
+		transform(offset.cbegin() + 1U, offset.cend(), this->Offset.begin() + element_base[i] + 1U,
+			[current_value_base](const auto current_offset) noexcept -> OffsetType { return current_value_base + current_offset; });
+	});
+}
+
 #define INSTANTIATE_DENSE(TYPE) template class DisRegRep::Container::SplattingCoefficient::BasicDense<TYPE>
 #define INSTANTIATE_SPARSE(TYPE) template class DisRegRep::Container::SplattingCoefficient::BasicSparse<TYPE>
+#define INSTANTIATE_PLANAR(TYPE) template class DisRegRep::Container::SplattingCoefficient::BasicPlanar<TYPE>
 
 #define INSTANTIATE_ALL(TYPE) \
 	INSTANTIATE_DENSE(TYPE); \
 	INSTANTIATE_SPARSE(TYPE)
 INSTANTIATE_ALL(RegionImportance);
-INSTANTIATE_ALL(RegionMask);
\ No newline at end of file
+INSTANTIATE_ALL(RegionMask);
+INSTANTIATE_ALL(Float16);
+INSTANTIATE_ALL(BFloat16);
+INSTANTIATE_PLANAR(RegionMask);
+
+#define INSTANTIATE_COMPACT_SPARSE(STORAGE) \
+	template class DisRegRep::Container::SplattingCoefficient::BasicCompactSparse<RegionMask, STORAGE>
+INSTANTIATE_COMPACT_SPARSE(RegionMask);
+INSTANTIATE_COMPACT_SPARSE(std::uint16_t);
+
+#define INSTANTIATE_TOP_K(K) template class DisRegRep::Container::SplattingCoefficient::BasicTopK<RegionMask, K>
+INSTANTIATE_TOP_K(1U);
+INSTANTIATE_TOP_K(2U);
+INSTANTIATE_TOP_K(3U);
+INSTANTIATE_TOP_K(4U);
\ No newline at end of file
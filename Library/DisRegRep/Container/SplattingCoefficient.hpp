@@ -2,28 +2,36 @@
 
 #include "SparseMatrixElement.hpp"
 
+#include <DisRegRep/Core/View/Arithmetic.hpp>
+#include <DisRegRep/Core/View/Functional.hpp>
 #include <DisRegRep/Core/View/Matrix.hpp>
 #include <DisRegRep/Core/View/Trait.hpp>
+#include <DisRegRep/Core/HalfPrecision.hpp>
 #include <DisRegRep/Core/Type.hpp>
 #include <DisRegRep/Core/UninitialisedAllocator.hpp>
 
 #include <glm/vec2.hpp>
 #include <glm/vec3.hpp>
 
+#include <array>
 #include <mdspan>
 #include <span>
 #include <tuple>
 #include <vector>
 
 #include <algorithm>
+#include <functional>
 #include <iterator>
 #include <ranges>
 
 #include <memory>
 #include <utility>
 
+#include <concepts>
+#include <limits>
 #include <type_traits>
 
+#include <cmath>
 #include <cstdint>
 
 /**
@@ -60,6 +68,19 @@ class BasicDense;
 
 using DenseImportance = BasicDense<Core::Type::RegionImportance>; /**< Dense region importance. */
 using DenseMask = BasicDense<Core::Type::RegionMask>; /**< Dense region mask. */
+using DenseMaskFloat16 = BasicDense<Core::HalfPrecision::Float16>; /**< Dense region mask in IEEE half precision. */
+using DenseMaskBFloat16 = BasicDense<Core::HalfPrecision::BFloat16>; /**< Dense region mask in brain floating point. */
+
+/**
+ * @brief A planar SCM is a dense SCM stored region-major, such that all splatting coefficients of a region form a contiguous plane of
+ * width by height, for consumers that process one region at a time.
+ *
+ * @tparam V Splatting coefficient value type.
+ */
+template<typename>
+class BasicPlanar;
+
+using PlanarMask = BasicPlanar<Core::Type::RegionMask>; /**< Planar region mask. */
 
 /**
  * @brief A sparse SCM is a partial sparse matrix that uses compressed sparse format on the region axis (i.e. the Z axis), the rest of
@@ -72,6 +93,38 @@ class BasicSparse;
 
 using SparseImportance = BasicSparse<Core::Type::RegionImportance>; /**< Sparse region importance. */
 using SparseMask = BasicSparse<Core::Type::RegionMask>; /**< Sparse region mask. */
+using SparseMaskFloat16 = BasicSparse<Core::HalfPrecision::Float16>; /**< Sparse region mask in IEEE half precision. */
+using SparseMaskBFloat16 = BasicSparse<Core::HalfPrecision::BFloat16>; /**< Sparse region mask in brain floating point. */
+
+/**
+ * @brief A compact sparse SCM has the same compressed sparse format as a sparse SCM, except region identifiers and values are stored in
+ * two separate arrays that share the same offsets, such that no padding is needed between them. Values can optionally be quantised to
+ * unsigned normalised fixed points to further reduce memory usage.
+ *
+ * @tparam V Splatting coefficient value type.
+ * @tparam S Type of value stored in memory. If it is an unsigned integer, values must be within [0.0, 1.0].
+ */
+template<std::floating_point V, typename S = V>
+requires(std::is_same_v<S, V> || std::unsigned_integral<S>)
+class BasicCompactSparse;
+
+using CompactSparseMask = BasicCompactSparse<Core::Type::RegionMask>; /**< Compact sparse region mask. */
+using QuantisedSparseMask = BasicCompactSparse<Core::Type::RegionMask, std::uint16_t>; /**< Compact sparse region mask with 16-bit values. */
+
+/**
+ * @brief A top-K SCM only keeps at most K greatest splatting coefficients along the Z axis, which are renormalised such that they sum
+ * up to one. Values are stored inline with a fixed stride of K on the Z axis, such that memory usage is predictable and every element
+ * can be accessed, and written to, in constant time and in any order.
+ *
+ * @tparam V Splatting coefficient value type.
+ * @tparam K Maximum number of coefficients kept per element.
+ */
+template<std::floating_point V, std::uint_fast8_t K>
+requires(K >= 1U && K <= 4U)
+class BasicTopK;
+
+template<std::uint_fast8_t K>
+using TopKMask = BasicTopK<Core::Type::RegionMask, K>; /**< Top-K region mask. */
 
 template<typename V>
 class BasicDense {
@@ -262,6 +315,154 @@ public:
 
 };
 
+template<typename V>
+class BasicPlanar {
+public:
+
+	using ValueType = V;
+	using ElementType = ValueType;
+	using ConstElement = std::add_const_t<ElementType>;
+	using IndexType = Type::IndexType;
+
+	using Dimension2Type = Type::Dimension2Type;
+	using Dimension3Type = Type::Dimension3Type;
+
+	using ExtentType = std::dextents<IndexType, 3U>;
+	using LayoutType = std::layout_stride;
+	using MdSpanType = std::mdspan<ElementType, ExtentType, LayoutType>;
+	using MappingType = typename MdSpanType::mapping_type;
+
+private:
+
+	using DataContainerType = std::vector<ElementType, Core::UninitialisedAllocator<ElementType>>;
+
+	MappingType Mapping;
+	DataContainerType PlanarMatrix;
+
+	//Number of elements in each plane.
+	[[nodiscard]] constexpr IndexType planeSize() const noexcept {
+		return this->Mapping.stride(2U);
+	}
+
+public:
+
+	using SizeType = typename DataContainerType::size_type;
+
+	/**
+	 * @brief A proxy that acts like a lvalue reference to values along the Z axis of the planar matrix, which are one plane apart.
+	 */
+	template<bool Const, std::ranges::view ElemView>
+	using ValueProxy = typename BasicDense<ValueType>::template ValueProxy<Const, ElemView>;
+
+	constexpr BasicPlanar() = default;
+
+	BasicPlanar(const BasicPlanar&) = delete;
+
+	constexpr BasicPlanar(BasicPlanar&&) noexcept = default;
+
+	BasicPlanar& operator=(const BasicPlanar&) = delete;
+
+	constexpr BasicPlanar& operator=(BasicPlanar&&) noexcept = default;
+
+	constexpr ~BasicPlanar() = default;
+
+	/**
+	 * @brief Get the planar matrix extent.
+	 *
+	 * @return Planar matrix extent.
+	 */
+	[[nodiscard]] Dimension3Type extent() const noexcept;
+
+	/**
+	 * @brief Get the linear size of the planar matrix.
+	 *
+	 * @return The total number of splatting coefficient stored.
+	 */
+	[[nodiscard]] constexpr IndexType size() const noexcept {
+		return this->PlanarMatrix.size();
+	}
+
+	/**
+	 * @brief Check if the planar matrix is empty.
+	 *
+	 * @return True if empty.
+	 */
+	[[nodiscard]] constexpr bool empty() const noexcept {
+		return this->PlanarMatrix.empty();
+	}
+
+	/**
+	 * @brief Get the size of the planar matrix in bytes.
+	 *
+	 * @return Size in bytes.
+	 */
+	[[nodiscard]] SizeType sizeByte() const noexcept;
+
+	/**
+	 * @brief Resize the current planar matrix. All existing contents become undefined.
+	 *
+	 * @param dim Provide width, height and region count of the planar matrix.
+	 */
+	void resize(Dimension3Type);
+
+	/**
+	 * @brief Get a multi-dimension view on the planar matrix, with axes of width, height and region count.
+	 *
+	 * @return The mdspan of the planar matrix.
+	 */
+	[[nodiscard]] constexpr auto mdspan(this auto& self) noexcept {
+		return std::mdspan(self.PlanarMatrix.data(), self.Mapping);
+	}
+
+	/**
+	 * @brief Get the plane of a region.
+	 *
+	 * @param region Region identifier.
+	 *
+	 * @return Splatting coefficients of `region` of every element, whose column has a stride of one.
+	 */
+	[[nodiscard]] constexpr auto plane(this auto& self, const IndexType region) noexcept {
+		const IndexType plane_size = self.planeSize();
+		return std::span(self.PlanarMatrix).subspan(region * plane_size, plane_size);
+	}
+
+	/**
+	 * @brief Get a range to the planar matrix, in the same order as @link BasicDense::range.
+	 *
+	 * @return A range to the planar matrix.
+	 */
+	template<typename Self>
+	[[nodiscard]] constexpr std::ranges::view auto range(this Self& self) noexcept {
+		using std::views::iota, std::views::stride, std::views::transform, std::bool_constant;
+
+		const IndexType plane_size = self.planeSize();
+		return iota(IndexType {}, plane_size)
+			| transform([matrix = std::span(self.PlanarMatrix), plane_size](const IndexType element) constexpr noexcept {
+				auto region_val = matrix.subspan(element) | stride(plane_size);
+				return ValueProxy<std::is_const_v<Self>, decltype(region_val)>(bool_constant<std::is_const_v<Self>> {}, std::move(region_val));
+			});
+	}
+
+	/**
+	 * @brief Get a 2D range to the planar matrix.
+	 *
+	 * @return A 2D range to the planar matrix.
+	 */
+	[[nodiscard]] constexpr std::ranges::view auto range2d(this auto& self) noexcept {
+		return self.range() | Core::View::Matrix::NewAxisLeft(self.Mapping.extents().extent(1U));
+	}
+
+	/**
+	 * @brief Get a transposed 2D range to the planar matrix.
+	 *
+	 * @return A transposed 2D range to the planar matrix.
+	 */
+	[[nodiscard]] constexpr std::ranges::view auto rangeTransposed2d() const noexcept {
+		return this->range() | Core::View::Matrix::NewAxisRight(this->Mapping.extents().extent(1U));
+	}
+
+};
+
 template<typename V>
 class BasicSparse {
 public:
@@ -360,13 +561,18 @@ public:
 		 *
 		 * @return Self.
 		 */
-		template<std::ranges::input_range Value>
-		requires std::is_same_v<std::ranges::range_value_t<Value>, ElementType>
+		template<std::ranges::input_range Value, typename ValueElement = std::ranges::range_value_t<Value>>
+		requires SparseMatrixElement::Is<ValueElement> && std::is_convertible_v<typename ValueElement::ValueType, ValueType>
 		constexpr const ValueProxy& operator=(Value&& value) const
 		requires(!IsConstant)
 		{
 			auto& [_, next] = this->PairwiseOffset;
-			this->ElementContainer->append_range(std::forward<Value>(value));
+			if constexpr (std::is_same_v<ValueElement, ElementType>) {
+				this->ElementContainer->append_range(std::forward<Value>(value));
+			} else {
+				//Such as storing single precision values into a half precision matrix.
+				this->ElementContainer->append_range(std::forward<Value>(value) | SparseMatrixElement::Cast<ValueType>);
+			}
 			next = this->ElementContainer->size();
 			return *this;
 		}
@@ -392,6 +598,87 @@ public:
 
 	};
 
+	/**
+	 * @brief A segment is a private sparse matrix of a contiguous range of elements, in contiguous memory order, of a sparse matrix.
+	 * Segments are built independently, such as one per thread, and later stitched into a sparse matrix with
+	 * @link BasicSparse::assemble.
+	 */
+	class Segment {
+	private:
+
+		friend BasicSparse;
+
+		OffsetContainerType Offset;
+		ElementContainerType SparseMatrix;
+
+	public:
+
+		constexpr Segment() noexcept = default;
+
+		Segment(const Segment&) = delete;
+
+		constexpr Segment(Segment&&) noexcept = default;
+
+		Segment& operator=(const Segment&) = delete;
+
+		constexpr Segment& operator=(Segment&&) noexcept = default;
+
+		constexpr ~Segment() = default;
+
+		/**
+		 * @brief Get the number of elements in the segment.
+		 *
+		 * @return Number of elements.
+		 */
+		[[nodiscard]] constexpr IndexType count() const noexcept {
+			return this->Offset.size() - 1U;
+		}
+
+		/**
+		 * @brief Get the size of the segment in bytes.
+		 *
+		 * @return Size in bytes.
+		 */
+		[[nodiscard]] SizeType sizeByte() const noexcept;
+
+		/**
+		 * @brief Resize the current segment. All existing contents are discarded.
+		 *
+		 * @param count Number of elements in the segment.
+		 */
+		void resize(IndexType);
+
+		/**
+		 * @brief Get a range to the segment, which behaves like @link BasicSparse::range. Like the sparse matrix, values must be
+		 * written to the segment in order.
+		 *
+		 * @return A range to the segment.
+		 */
+		template<typename Self>
+		[[nodiscard]] constexpr std::ranges::view auto range(this Self& self) noexcept {
+			return BasicSparse::makeRange(self.Offset, self.SparseMatrix);
+		}
+
+	};
+
+private:
+
+	//Pair adjacent offsets and the element container to make a range of value proxies.
+	template<typename Offset, typename Element>
+	[[nodiscard]] static constexpr std::ranges::view auto makeRange(Offset& offset, Element& element) noexcept {
+		using std::views::pairwise, std::views::transform;
+		using ProxyType = ValueProxy<std::is_const_v<Element>>;
+
+		//Not using pairwise_transform since I need to pass the original tuple to the proxy.
+		return offset
+			| pairwise
+			| transform([&element](auto pairwise_offset) constexpr noexcept {
+				return ProxyType(std::move(pairwise_offset), element);
+			});
+	}
+
+public:
+
 	constexpr BasicSparse() noexcept = default;
 
 	BasicSparse(const BasicSparse&) = delete;
@@ -463,6 +750,15 @@ public:
 	 */
 	void resize(Dimension3Type);
 
+	/**
+	 * @brief Overwrite the content of the sparse matrix by stitching segments together. Offsets of every segment are rebased with a
+	 * prefix sum of the segment sizes, then all segments are copied to the sparse matrix in parallel.
+	 *
+	 * @param segment Segments ordered by their positions in the sparse matrix. The total number of elements of all segments must
+	 * equal to that of the sparse matrix.
+	 */
+	void assemble(std::span<const Segment>);
+
 	/**
 	 * @brief Get a range to the sparse matrix.
 	 *
@@ -470,15 +766,7 @@ public:
 	 */
 	template<typename Self>
 	[[nodiscard]] constexpr std::ranges::view auto range(this Self& self) noexcept {
-		using std::views::pairwise, std::views::transform;
-		using ProxyType = ValueProxy<std::is_const_v<Self>>;
-
-		//Not using pairwise_transform since I need to pass the original tuple to the proxy.
-		return self.Offset
-			| pairwise
-			| transform([&elem = self.SparseMatrix](auto pairwise_offset) constexpr noexcept {
-				return ProxyType(std::move(pairwise_offset), elem);
-			});
+		return BasicSparse::makeRange(self.Offset, self.SparseMatrix);
 	}
 
 	/**
@@ -501,22 +789,595 @@ public:
 
 };
 
-/**
- * `Mat` is a specialisation of `BasicDense`.
- */
-template<typename Mat>
-concept IsDense = std::is_same_v<Mat, BasicDense<typename Mat::ValueType>>;
+template<std::floating_point V, typename S>
+requires(std::is_same_v<S, V> || std::unsigned_integral<S>)
+class BasicCompactSparse {
+public:
 
-/**
- * `Mat` is a specialisation of `BasicSparse`.
- */
-template<typename Mat>
-concept IsSparse = std::is_same_v<Mat, BasicSparse<typename Mat::ValueType>>;
+	static constexpr bool IsQuantised = !std::is_same_v<S, V>;
+
+	using ValueType = V;
+	using StorageType = S;
+	using ElementType = SparseMatrixElement::Basic<ValueType>;
+	using IdentifierType = Core::Type::RegionIdentifier;
+	using OffsetType = std::uint_least32_t;
+	using ConstOffset = std::add_const_t<OffsetType>;
+	using IndexType = Type::IndexType;
+
+	using Dimension2Type = Type::Dimension2Type;
+	using Dimension3Type = Type::Dimension3Type;
+
+	using OffsetExtentType = std::dextents<IndexType, 2U>;
+	using OffsetLayoutType = Type::LayoutType;
+	using OffsetMdSpanType = std::mdspan<OffsetType, OffsetExtentType, OffsetLayoutType>;
+	using OffsetMappingType = OffsetMdSpanType::mapping_type;
+
+	/**
+	 * @brief Convert a value to be stored in memory.
+	 *
+	 * @param value Value to be converted.
+	 *
+	 * @return Stored value.
+	 */
+	[[nodiscard]] static constexpr StorageType encode(const ValueType value) noexcept {
+		if constexpr (IsQuantised) {
+			return static_cast<StorageType>(std::round(value * std::numeric_limits<StorageType>::max()));
+		} else {
+			return value;
+		}
+	}
+
+	/**
+	 * @brief Convert a value stored in memory back.
+	 *
+	 * @param storage Stored value.
+	 *
+	 * @return Value.
+	 */
+	[[nodiscard]] static constexpr ValueType decode(const StorageType storage) noexcept {
+		if constexpr (IsQuantised) {
+			return storage * (ValueType { 1 } / std::numeric_limits<StorageType>::max());
+		} else {
+			return storage;
+		}
+	}
+
+private:
+
+	using OffsetContainerType = std::vector<OffsetType>;
+	using IdentifierContainerType = std::vector<IdentifierType>;
+	using ValueContainerType = std::vector<StorageType>;
+
+	OffsetMappingType OffsetMapping;
+	OffsetContainerType Offset;
+	IdentifierContainerType Identifier;
+	ValueContainerType Value;
+
+	//Linear size of the dense offset matrix.
+	[[nodiscard]] constexpr IndexType sizeOffset() const noexcept {
+		return this->OffsetMapping.required_span_size() + 1U;
+	}
+
+public:
+
+	using SizeType = std::common_type_t<
+		OffsetContainerType::size_type,
+		typename IdentifierContainerType::size_type,
+		typename ValueContainerType::size_type
+	>;
+
+	/**
+	 * @brief A proxy of values along the Z axis of the compact sparse matrix.
+	 *
+	 * @tparam Const True if the values are constant.
+	 */
+	template<bool Const>
+	class ValueProxy {
+	public:
+
+		static constexpr bool IsConstant = Const;
+
+		template<typename T>
+		using MaybeConst = std::conditional_t<IsConstant, std::add_const_t<T>, T>;
+
+		using ProxyIdentifierContainerPointer = std::add_pointer_t<MaybeConst<IdentifierContainerType>>;
+		using ProxyValueContainerPointer = std::add_pointer_t<MaybeConst<ValueContainerType>>;
+
+		using ProxyOffsetReference = std::add_lvalue_reference_t<MaybeConst<OffsetType>>;
+		using ProxyPairwiseOffsetType = std::tuple<ProxyOffsetReference, ProxyOffsetReference>;
+
+		using ProxyElementViewType = decltype(std::views::zip(
+			std::declval<std::span<const IdentifierType>>(),
+			std::declval<std::span<const StorageType>>() | std::views::transform(&BasicCompactSparse::decode)
+		) | Core::View::Functional::MakeFromTuple<ElementType>);
+		using ProxyElementViewIterator = std::ranges::iterator_t<ProxyElementViewType>;
+
+	private:
+
+		ProxyPairwiseOffsetType PairwiseOffset;
+		ProxyIdentifierContainerPointer IdentifierContainer;
+		ProxyValueContainerPointer ValueContainer;
+
+	public:
+
+		/**
+		 * @brief Initialise a value proxy.
+		 *
+		 * @param pairwise_offset The offset of the **next** element in the contiguous memory order.
+		 * @param identifier The region identifier container.
+		 * @param value The value container.
+		 */
+		constexpr ValueProxy(
+			ProxyPairwiseOffsetType pairwise_offset,
+			MaybeConst<IdentifierContainerType>& identifier,
+			MaybeConst<ValueContainerType>& value
+		) noexcept :
+			PairwiseOffset(std::move(pairwise_offset)),
+			IdentifierContainer(std::addressof(identifier)),
+			ValueContainer(std::addressof(value)) { }
+
+		/**
+		 * @brief Get the view of values.
+		 *
+		 * @return View of sparse matrix elements, whose values are decoded on access.
+		 */
+		[[nodiscard]] constexpr ProxyElementViewType operator*() const noexcept {
+			using std::views::zip, std::views::transform;
+			const auto [prev, next] = this->PairwiseOffset;
+			const auto count = next - prev;
+			return zip(
+				std::span<const IdentifierType>(*this->IdentifierContainer).subspan(prev, count),
+				std::span<const StorageType>(*this->ValueContainer).subspan(prev, count) | transform(&BasicCompactSparse::decode)
+			) | Core::View::Functional::MakeFromTuple<ElementType>;
+		}
+
+		/**
+		 * @brief Append a range of sparse matrix to the view in this proxy.
+		 *
+		 * @tparam Value Type of range value.
+		 *
+		 * @param value Values to be appended.
+		 *
+		 * @return Self.
+		 */
+		template<std::ranges::input_range Value>
+		requires SparseMatrixElement::Is<std::ranges::range_value_t<Value>>
+			  && std::is_convertible_v<typename std::ranges::range_value_t<Value>::ValueType, ValueType>
+		constexpr const ValueProxy& operator=(Value&& value) const
+		requires(!IsConstant)
+		{
+			auto& [_, next] = this->PairwiseOffset;
+			for (const auto& [identifier, current_value] : std::forward<Value>(value)) {
+				this->IdentifierContainer->push_back(identifier);
+				this->ValueContainer->push_back(BasicCompactSparse::encode(static_cast<ValueType>(current_value)));
+			}
+			next = this->ValueContainer->size();
+			return *this;
+		}
+
+		/**
+		 * @brief Append a range of dense matrix to the view in this proxy.
+		 *
+		 * @tparam Value Type of range value.
+		 *
+		 * @param value Values to be appended.
+		 *
+		 * @return Self.
+		 */
+		template<std::ranges::input_range Value>
+		requires std::ranges::viewable_range<Value>
+			  && std::is_convertible_v<std::ranges::range_value_t<Value>, ValueType>
+		constexpr const ValueProxy& operator=(Value&& value) const
+		requires(!IsConstant)
+		{
+			*this = std::forward<Value>(value) | SparseMatrixElement::ToSparse;
+			return *this;
+		}
+
+	};
+
+	constexpr BasicCompactSparse() noexcept = default;
+
+	BasicCompactSparse(const BasicCompactSparse&) = delete;
+
+	constexpr BasicCompactSparse(BasicCompactSparse&&) noexcept = default;
+
+	BasicCompactSparse& operator=(const BasicCompactSparse&) = delete;
+
+	constexpr BasicCompactSparse& operator=(BasicCompactSparse&&) noexcept = default;
+
+	constexpr ~BasicCompactSparse() = default;
+
+	/**
+	 * @brief Sort the values of each element in the compact sparse matrix, in ascending order of region identifier.
+	 *
+	 * @link BasicCompactSparse::isSorted
+	 */
+	void sort();
+
+	/**
+	 * @brief Check if the values of each element in the compact sparse matrix is sorted.
+	 *
+	 * @link BasicCompactSparse::sort
+	 *
+	 * @return True if all sorted.
+	 */
+	[[nodiscard]] bool isSorted() const;
+
+	/**
+	 * @brief Get the compact sparse matrix extent.
+	 *
+	 * @note Like the sparse matrix, the mapping only maps the dense axes.
+	 *
+	 * @return Compact sparse matrix extent.
+	 */
+	[[nodiscard]] Dimension2Type extent() const noexcept;
+
+	/**
+	 * @brief Get the linear size of the compact sparse matrix.
+	 *
+	 * @return The total number of splatting coefficient stored.
+	 */
+	[[nodiscard]] constexpr IndexType size() const noexcept {
+		return this->Value.size();
+	}
+
+	/**
+	 * @brief Check if the compact sparse matrix is empty.
+	 *
+	 * @return True if empty.
+	 */
+	[[nodiscard]] constexpr bool empty() const noexcept {
+		return this->Value.empty();
+	}
+
+	/**
+	 * @brief Get the size of the compact sparse matrix in bytes.
+	 *
+	 * @return Size in bytes.
+	 */
+	[[nodiscard]] SizeType sizeByte() const noexcept;
+
+	/**
+	 * @brief Resize the current compact sparse matrix. All existing contents become undefined, and the internal state of the matrix is
+	 * reset, thus suitable for commencing new computations.
+	 *
+	 * @param dim Provide width and height of the compact sparse matrix. The region count is unused, but should still be provided to
+	 * keep API consistency.
+	 */
+	void resize(Dimension3Type);
+
+	/**
+	 * @brief Get all stored values in contiguous memory order, for passes that operate on values only and do not need to know which
+	 * element or region a value belongs to.
+	 *
+	 * @return All stored values.
+	 */
+	[[nodiscard]] constexpr auto value(this auto& self) noexcept {
+		return std::span(self.Value);
+	}
+
+	/**
+	 * @brief Get a range to the compact sparse matrix.
+	 *
+	 * @return A range to the compact sparse matrix.
+	 */
+	template<typename Self>
+	[[nodiscard]] constexpr std::ranges::view auto range(this Self& self) noexcept {
+		using std::views::pairwise, std::views::transform;
+		using ProxyType = ValueProxy<std::is_const_v<Self>>;
+
+		return self.Offset
+			| pairwise
+			| transform([&identifier = self.Identifier, &value = self.Value](auto pairwise_offset) constexpr noexcept {
+				return ProxyType(std::move(pairwise_offset), identifier, value);
+			});
+	}
+
+	/**
+	 * @brief Get a 2D range to the compact sparse matrix.
+	 *
+	 * @return A 2D range to the compact sparse matrix.
+	 */
+	[[nodiscard]] constexpr std::ranges::view auto range2d(this auto& self) noexcept {
+		return self.range() | Core::View::Matrix::NewAxisLeft(self.OffsetMapping.stride(0U));
+	}
+
+	/**
+	 * @brief Get a transposed 2D range to the compact sparse matrix.
+	 *
+	 * @return A transposed 2D range to the compact sparse matrix.
+	 */
+	[[nodiscard]] constexpr std::ranges::view auto rangeTransposed2d() const noexcept {
+		return this->range() | Core::View::Matrix::NewAxisRight(this->OffsetMapping.stride(0U));
+	}
+
+};
+
+template<std::floating_point V, std::uint_fast8_t K>
+requires(K >= 1U && K <= 4U)
+class BasicTopK {
+public:
+
+	static constexpr std::uint_fast8_t Capacity = K;
+
+	using ValueType = V;
+	using ElementType = SparseMatrixElement::Basic<ValueType>;
+	using IdentifierType = Core::Type::RegionIdentifier;
+	using IndexType = Type::IndexType;
+
+	using Dimension2Type = Type::Dimension2Type;
+	using Dimension3Type = Type::Dimension3Type;
+
+	using ExtentType = std::dextents<IndexType, 2U>;
+	using LayoutType = Type::LayoutType;
+	using MappingType = std::mdspan<ValueType, ExtentType, LayoutType>::mapping_type;
+
+private:
+
+	//Identifiers and values are stored in separate containers to avoid padding.
+	using IdentifierContainerType = std::vector<IdentifierType, Core::UninitialisedAllocator<IdentifierType>>;
+	using ValueContainerType = std::vector<ValueType, Core::UninitialisedAllocator<ValueType>>;
+
+	MappingType Mapping;
+	IdentifierContainerType Identifier;
+	ValueContainerType Value;
+
+public:
+
+	using SizeType = std::common_type_t<typename IdentifierContainerType::size_type, typename ValueContainerType::size_type>;
+
+	/**
+	 * @brief A proxy of values along the Z axis of the top-K matrix.
+	 *
+	 * @tparam Const True if the values are constant.
+	 */
+	template<bool Const>
+	class ValueProxy {
+	public:
+
+		static constexpr bool IsConstant = Const;
+
+		using ProxyIdentifierViewType = std::span<std::conditional_t<IsConstant, std::add_const_t<IdentifierType>, IdentifierType>, Capacity>;
+		using ProxyValueViewType = std::span<std::conditional_t<IsConstant, std::add_const_t<ValueType>, ValueType>, Capacity>;
+
+		using ProxyElementViewType = decltype(std::views::zip(
+			std::declval<std::span<const IdentifierType>>(),
+			std::declval<std::span<const ValueType>>()
+		) | Core::View::Functional::MakeFromTuple<ElementType>);
+		using ProxyElementViewIterator = std::ranges::iterator_t<ProxyElementViewType>;
+
+	private:
+
+		ProxyIdentifierViewType IdentifierView;
+		ProxyValueViewType ValueView;
+
+	public:
+
+		/**
+		 * @brief Initialise a value proxy.
+		 *
+		 * @tparam RI Type of identifier range.
+		 * @tparam RV Type of value range.
+		 *
+		 * @param identifier Range of region identifiers of this element, with a size of the capacity.
+		 * @param value Range of values of this element, with a size of the capacity.
+		 */
+		template<std::ranges::contiguous_range RI, std::ranges::contiguous_range RV>
+		constexpr ValueProxy(RI&& identifier, RV&& value) noexcept :
+			IdentifierView(std::ranges::data(identifier), Capacity), ValueView(std::ranges::data(value), Capacity) { }
+
+		/**
+		 * @brief Get the view of values.
+		 *
+		 * @return View of sparse matrix elements, sorted by region identifier.
+		 */
+		[[nodiscard]] constexpr ProxyElementViewType operator*() const noexcept {
+			using std::views::zip;
+			//Unused slots always come after all used slots, and a used slot never holds a zero value.
+			const auto size = std::ranges::distance(this->ValueView.begin(), std::ranges::find(this->ValueView, ValueType {}));
+			return zip(
+				std::span<const IdentifierType>(this->IdentifierView.first(size)),
+				std::span<const ValueType>(this->ValueView.first(size))
+			) | Core::View::Functional::MakeFromTuple<ElementType>;
+		}
+
+		/**
+		 * @brief Keep the greatest values from a range of sparse matrix and write them to this proxy after renormalisation.
+		 *
+		 * @tparam Value Type of range value.
+		 *
+		 * @param value Values to be written. Non-positive values are discarded. When there are ties, the one appears first is
+		 * kept.
+		 *
+		 * @return Self.
+		 */
+		template<std::ranges::input_range Value>
+		requires SparseMatrixElement::Is<std::ranges::range_value_t<Value>>
+			  && std::is_convertible_v<typename std::ranges::range_value_t<Value>::ValueType, ValueType>
+		constexpr const ValueProxy& operator=(Value&& value) const
+		requires(!IsConstant)
+		{
+			using std::ranges::min_element, std::ranges::sort, std::ranges::fold_left, std::ranges::fill, std::ranges::copy,
+				std::views::transform, std::mem_fn, std::plus;
+
+			std::array<ElementType, Capacity> strongest {};
+			auto strongest_end = strongest.begin();
+			for (const auto& [identifier, current_value] : std::forward<Value>(value)) {
+				const ElementType element {
+					.Identifier = identifier,
+					.Value = static_cast<ValueType>(current_value)
+				};
+				if (!(element.Value > ValueType {})) {
+					continue;
+				}
+				if (strongest_end != strongest.end()) {
+					*strongest_end++ = element;
+					continue;
+				}
+				if (auto& weakest = *min_element(strongest, {}, mem_fn(&ElementType::Value));
+					weakest.Value < element.Value) {
+					weakest = element;
+				}
+			}
+
+			const std::span selected(strongest.begin(), strongest_end);
+			sort(selected, {}, mem_fn(&ElementType::Identifier));
+			fill(this->IdentifierView, IdentifierType {});
+			fill(this->ValueView, ValueType {});
+			copy(selected | transform(mem_fn(&ElementType::Identifier)), this->IdentifierView.begin());
+			copy(selected | transform(mem_fn(&ElementType::Value)) | Core::View::Arithmetic::Normalise(
+				fold_left(selected | transform(mem_fn(&ElementType::Value)), ValueType {}, plus {})), this->ValueView.begin());
+			return *this;
+		}
+
+		/**
+		 * @brief Keep the greatest values from a range of dense matrix and write them to this proxy after renormalisation.
+		 *
+		 * @tparam Value Type of range value.
+		 *
+		 * @param value Values to be written.
+		 *
+		 * @return Self.
+		 */
+		template<std::ranges::input_range Value>
+		requires std::ranges::viewable_range<Value>
+			  && std::is_convertible_v<std::ranges::range_value_t<Value>, ValueType>
+		constexpr const ValueProxy& operator=(Value&& value) const
+		requires(!IsConstant)
+		{
+			*this = std::forward<Value>(value) | SparseMatrixElement::ToSparse;
+			return *this;
+		}
+
+	};
+
+	constexpr BasicTopK() = default;
+
+	BasicTopK(const BasicTopK&) = delete;
+
+	constexpr BasicTopK(BasicTopK&&) noexcept = default;
+
+	BasicTopK& operator=(const BasicTopK&) = delete;
+
+	constexpr BasicTopK& operator=(BasicTopK&&) noexcept = default;
+
+	constexpr ~BasicTopK() = default;
+
+	/**
+	 * @brief Get the top-K matrix extent.
+	 *
+	 * @note Like the sparse matrix, the mapping only maps the dense axes.
+	 *
+	 * @return Top-K matrix extent.
+	 */
+	[[nodiscard]] Dimension2Type extent() const noexcept;
+
+	/**
+	 * @brief Get the linear size of the top-K matrix.
+	 *
+	 * @return The total number of splatting coefficient slots, including the unused ones.
+	 */
+	[[nodiscard]] constexpr IndexType size() const noexcept {
+		return this->Value.size();
+	}
+
+	/**
+	 * @brief Check if the top-K matrix is empty.
+	 *
+	 * @return True if empty.
+	 */
+	[[nodiscard]] constexpr bool empty() const noexcept {
+		return this->Value.empty();
+	}
+
+	/**
+	 * @brief Get the size of the top-K matrix in bytes.
+	 *
+	 * @return Size in bytes.
+	 */
+	[[nodiscard]] SizeType sizeByte() const noexcept;
+
+	/**
+	 * @brief Resize the current top-K matrix. All existing contents become undefined, and the internal state of the matrix is reset,
+	 * thus suitable for commencing new computations.
+	 *
+	 * @param dim Provide width and height of the top-K matrix. The region count is unused, but should still be provided to keep API
+	 * consistency.
+	 */
+	void resize(Dimension3Type);
+
+	/**
+	 * @brief Get a range to the top-K matrix.
+	 *
+	 * @return A random access range to the top-K matrix.
+	 */
+	template<typename Self>
+	[[nodiscard]] constexpr std::ranges::view auto range(this Self& self) noexcept {
+		using std::views::zip, std::views::chunk, std::views::transform;
+		using ProxyType = ValueProxy<std::is_const_v<Self>>;
+
+		return zip(self.Identifier | chunk(Capacity), self.Value | chunk(Capacity))
+			| transform([](auto identifier_value) static constexpr noexcept {
+				auto [identifier, value] = std::move(identifier_value);
+				return ProxyType(std::move(identifier), std::move(value));
+			});
+	}
+
+	/**
+	 * @brief Get a 2D range to the top-K matrix.
+	 *
+	 * @return A 2D range to the top-K matrix.
+	 */
+	[[nodiscard]] constexpr std::ranges::view auto range2d(this auto& self) noexcept {
+		return self.range() | Core::View::Matrix::NewAxisLeft(self.Mapping.stride(0U));
+	}
+
+	/**
+	 * @brief Get a transposed 2D range to the top-K matrix.
+	 *
+	 * @return A transposed 2D range to the top-K matrix.
+	 */
+	[[nodiscard]] constexpr std::ranges::view auto rangeTransposed2d() const noexcept {
+		return this->range() | Core::View::Matrix::NewAxisRight(this->Mapping.stride(0U));
+	}
+
+};
+
+/**
+ * `Mat` is a specialisation of `BasicDense`.
+ */
+template<typename Mat>
+concept IsDense = std::is_same_v<Mat, BasicDense<typename Mat::ValueType>>;
+
+/**
+ * `Mat` is a specialisation of `BasicPlanar`.
+ */
+template<typename Mat>
+concept IsPlanar = std::is_same_v<Mat, BasicPlanar<typename Mat::ValueType>>;
+
+/**
+ * `Mat` is a specialisation of `BasicSparse`.
+ */
+template<typename Mat>
+concept IsSparse = std::is_same_v<Mat, BasicSparse<typename Mat::ValueType>>;
+
+/**
+ * `Mat` is a specialisation of `BasicCompactSparse`.
+ */
+template<typename Mat>
+concept IsCompactSparse = std::is_same_v<Mat, BasicCompactSparse<typename Mat::ValueType, typename Mat::StorageType>>;
+
+/**
+ * `Mat` is a specialisation of `BasicTopK`.
+ */
+template<typename Mat>
+concept IsTopK = std::is_same_v<Mat, BasicTopK<typename Mat::ValueType, Mat::Capacity>>;
 
 /**
  * `Mat` is a splatting coefficient matrix;
  */
 template<typename Mat>
-concept Is = IsDense<Mat> || IsSparse<Mat>;
+concept Is = IsDense<Mat> || IsPlanar<Mat> || IsSparse<Mat> || IsCompactSparse<Mat> || IsTopK<Mat>;
 
 }
\ No newline at end of file
@@ -0,0 +1,162 @@
+#pragma once
+
+#include <bit>
+
+#include <cstdint>
+
+/**
+ * @brief 16-bit floating point storage types for values that do not need single precision, such as region masks within [0.0, 1.0].
+ * Values are converted from and to single precision on access, and all arithmetic is carried out in single precision.
+ */
+namespace DisRegRep::Core::HalfPrecision {
+
+/**
+ * @brief Encoding of a 16-bit floating point.
+ */
+enum class Format : std::uint_fast8_t {
+	Binary16, /**< IEEE 754 binary16, with 5 exponent bits and 10 mantissa bits. */
+	BFloat16 /**< Brain floating point, with 8 exponent bits and 7 mantissa bits; the upper half of a single precision float. */
+};
+
+/**
+ * @brief A 16-bit floating point that is implicitly convertible from and to single precision. It is trivial, so it can be used
+ * wherever a built-in floating point is stored in bulk.
+ *
+ * @tparam F Encoding.
+ */
+template<Format F>
+class Basic {
+public:
+
+	using BitType = std::uint16_t;
+
+	static constexpr Format Encoding = F;
+
+private:
+
+	BitType Bit;
+
+	//Convert single precision to encoded bits, rounded to nearest even.
+	[[nodiscard]] static constexpr BitType encode(const float value) noexcept {
+		const auto u = std::bit_cast<std::uint32_t>(value);
+		if constexpr (Encoding == Format::BFloat16) {
+			if ((u & 0x7FFFFFFFU) > 0x7F800000U) [[unlikely]] {
+				//Make sure NaN does not become infinity after truncation.
+				return static_cast<BitType>((u >> 16U) | 0x0040U);
+			}
+			return static_cast<BitType>((u + 0x7FFFU + ((u >> 16U) & 1U)) >> 16U);
+		} else {
+			const auto sign = static_cast<BitType>((u >> 16U) & 0x8000U);
+			const std::uint32_t exponent = (u >> 23U) & 0xFFU;
+			std::uint32_t mantissa = u & 0x7FFFFFU;
+			if (exponent == 0xFFU) [[unlikely]] {
+				return static_cast<BitType>(sign | 0x7C00U | (mantissa == 0U ? 0x0000U : 0x0200U));
+			}
+
+			const auto half_exponent = static_cast<std::int_fast32_t>(exponent) - 127 + 15;
+			if (half_exponent >= 0x1F) [[unlikely]] {
+				return static_cast<BitType>(sign | 0x7C00U);
+			}
+			if (half_exponent <= 0) {
+				//Subnormal, or too small to be represented.
+				if (half_exponent < -10) {
+					return sign;
+				}
+				mantissa |= 0x800000U;
+				const auto shift = static_cast<std::uint32_t>(14 - half_exponent);
+				const std::uint32_t remainder = mantissa & ((1U << shift) - 1U), halfway = 1U << (shift - 1U);
+				auto half_mantissa = static_cast<BitType>(mantissa >> shift);
+				if (remainder > halfway || (remainder == halfway && (half_mantissa & 1U) != 0U)) {
+					++half_mantissa;
+				}
+				return static_cast<BitType>(sign | half_mantissa);
+			}
+
+			//A carry out of the mantissa correctly increments the exponent, or becomes infinity.
+			auto half = static_cast<BitType>(sign | (half_exponent << 10U) | (mantissa >> 13U));
+			if (const std::uint32_t remainder = mantissa & 0x1FFFU;
+				remainder > 0x1000U || (remainder == 0x1000U && (half & 1U) != 0U)) {
+				++half;
+			}
+			return half;
+		}
+	}
+
+	//Convert encoded bits to single precision, which is always exact.
+	[[nodiscard]] static constexpr float decode(const BitType bit) noexcept {
+		if constexpr (Encoding == Format::BFloat16) {
+			return std::bit_cast<float>(static_cast<std::uint32_t>(bit) << 16U);
+		} else {
+			const std::uint32_t sign = static_cast<std::uint32_t>(bit & 0x8000U) << 16U;
+			std::uint32_t exponent = (bit >> 10U) & 0x1FU, mantissa = bit & 0x3FFU;
+			if (exponent == 0x1FU) [[unlikely]] {
+				return std::bit_cast<float>(sign | 0x7F800000U | (mantissa << 13U));
+			}
+			if (exponent == 0U) {
+				if (mantissa == 0U) {
+					return std::bit_cast<float>(sign);
+				}
+				//Normalise a subnormal.
+				exponent = 1U;
+				while ((mantissa & 0x400U) == 0U) {
+					mantissa <<= 1U;
+					--exponent;
+				}
+				mantissa &= 0x3FFU;
+			}
+			return std::bit_cast<float>(sign | ((exponent + 112U) << 23U) | (mantissa << 13U));
+		}
+	}
+
+public:
+
+	/**
+	 * @brief Leave the value uninitialised, the same as a built-in floating point.
+	 */
+	constexpr Basic() noexcept = default;
+
+	/**
+	 * @brief Convert from single precision, rounded to the nearest representable value.
+	 *
+	 * @param value Single precision value.
+	 */
+	constexpr Basic(const float value) noexcept ://NOLINT(google-explicit-constructor, hicpp-explicit-conversions)
+		Bit(Basic::encode(value)) { }
+
+	/**
+	 * @brief Reinterpret encoded bits as a 16-bit floating point.
+	 *
+	 * @param bit Encoded bits.
+	 *
+	 * @return A 16-bit floating point.
+	 */
+	[[nodiscard]] static constexpr Basic fromBit(const BitType bit) noexcept {
+		Basic value;
+		value.Bit = bit;
+		return value;
+	}
+
+	/**
+	 * @brief Convert to single precision.
+	 *
+	 * @return Single precision value.
+	 */
+	[[nodiscard]] constexpr operator float() const noexcept {//NOLINT(google-explicit-constructor, hicpp-explicit-conversions)
+		return Basic::decode(this->Bit);
+	}
+
+	/**
+	 * @brief Get the encoded bits.
+	 *
+	 * @return Encoded bits.
+	 */
+	[[nodiscard]] constexpr BitType bit() const noexcept {
+		return this->Bit;
+	}
+
+};
+
+using Float16 = Basic<Format::Binary16>; /**< IEEE 754 half precision. */
+using BFloat16 = Basic<Format::BFloat16>; /**< Brain floating point. */
+
+}
\ No newline at end of file
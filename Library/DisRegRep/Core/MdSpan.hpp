@@ -2,10 +2,14 @@
 
 #include <glm/fwd.hpp>
 
+#include <array>
 #include <mdspan>
 
+#include <bit>
 #include <utility>
 
+#include <concepts>
+
 #include <cstddef>
 
 /**
@@ -69,4 +73,116 @@ template<glm::length_t L, typename T, glm::qualifier Q>
 	}(make_integer_sequence<glm::length_t, L> {});
 }
 
+/**
+ * @brief A layout mapping policy that divides the first two ranks into square blocks. Blocks are stored contiguously one after the
+ * other in row-major order, and so are the elements within a block. If present, the third rank is the innermost rank with a stride of
+ * one, such that it can describe a matrix of shape (width, height), or (width, height, region count).
+ *
+ * @note @link Container::Regionfield and dense containers keep @link std::layout_right. This layout is used by caller-provided buffers,
+ * such as the output of @link Splatting::Transfer, or a blocked regionfield matrix splatted through @link Container::RegionfieldView.
+ *
+ * Compared to @link std::layout_right, elements that are vertical neighbours are only a block apart rather than a full row apart,
+ * which improves locality of 2D window reads on wide matrices. Extents not divisible by the block size are padded to whole blocks.
+ *
+ * @tparam BlockSize Width and height of each block.
+ */
+template<std::size_t BlockSize>
+requires(std::has_single_bit(BlockSize))
+struct LayoutBlocked {
+
+	//NOLINTBEGIN(readability-identifier-naming)
+	template<typename Extents>
+	requires(Extents::rank() == 2U || Extents::rank() == 3U)
+	class mapping {
+	public:
+
+		using extents_type = Extents;
+		using index_type = typename extents_type::index_type;
+		using size_type = typename extents_type::size_type;
+		using rank_type = typename extents_type::rank_type;
+		using layout_type = LayoutBlocked;
+
+	private:
+
+		static constexpr index_type BlockLog2 = std::countr_zero(BlockSize),
+			BlockMask = BlockSize - 1U;
+		static constexpr bool HasInnerRank = extents_type::rank() == 3U;
+
+		extents_type Extent;
+		index_type BlockPerRow {}; /**< Number of blocks along the second rank. */
+
+		[[nodiscard]] static constexpr index_type blockCount(const index_type extent) noexcept {
+			return (extent + BlockMask) >> BlockLog2;
+		}
+
+		[[nodiscard]] constexpr index_type innerExtent() const noexcept {
+			if constexpr (HasInnerRank) {
+				return this->Extent.extent(2U);
+			} else {
+				return 1U;
+			}
+		}
+
+	public:
+
+		constexpr mapping() noexcept = default;
+
+		constexpr mapping(const extents_type& extent) noexcept ://NOLINT(google-explicit-constructor, hicpp-explicit-conversions)
+			Extent(extent), BlockPerRow(mapping::blockCount(extent.extent(1U))) { }
+
+		[[nodiscard]] constexpr const extents_type& extents() const noexcept {
+			return this->Extent;
+		}
+
+		[[nodiscard]] constexpr index_type required_span_size() const noexcept {
+			return (mapping::blockCount(this->Extent.extent(0U)) * this->BlockPerRow << 2U * BlockLog2) * this->innerExtent();
+		}
+
+		template<std::integral... I>
+		requires(sizeof...(I) == extents_type::rank())
+		[[nodiscard]] constexpr index_type operator()(const I... index) const noexcept {
+			const std::array<index_type, sizeof...(I)> idx { static_cast<index_type>(index)... };
+			const index_type block = (idx[0U] >> BlockLog2) * this->BlockPerRow + (idx[1U] >> BlockLog2),
+				element = (block << 2U * BlockLog2) | ((idx[0U] & BlockMask) << BlockLog2) | (idx[1U] & BlockMask);
+			if constexpr (HasInnerRank) {
+				return element * this->innerExtent() + idx[2U];
+			} else {
+				return element;
+			}
+		}
+
+		[[nodiscard]] static constexpr bool is_always_unique() noexcept {
+			return true;
+		}
+
+		[[nodiscard]] static constexpr bool is_always_exhaustive() noexcept {
+			return false;
+		}
+
+		[[nodiscard]] static constexpr bool is_always_strided() noexcept {
+			return false;
+		}
+
+		[[nodiscard]] static constexpr bool is_unique() noexcept {
+			return true;
+		}
+
+		[[nodiscard]] constexpr bool is_exhaustive() const noexcept {
+			return (this->Extent.extent(0U) & BlockMask) == 0U && (this->Extent.extent(1U) & BlockMask) == 0U;
+		}
+
+		[[nodiscard]] static constexpr bool is_strided() noexcept {
+			return false;
+		}
+
+		template<typename OtherExtents>
+		[[nodiscard]] friend constexpr bool operator==(const mapping& a, const mapping<OtherExtents>& b) noexcept {
+			return a.extents() == b.extents();
+		}
+
+	};
+	//NOLINTEND(readability-identifier-naming)
+
+};
+
 }
\ No newline at end of file
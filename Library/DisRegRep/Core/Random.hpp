@@ -0,0 +1,262 @@
+#pragma once
+
+#include "XXHash.hpp"
+
+#include <array>
+
+#include <string_view>
+#include <tuple>
+
+#include <algorithm>
+#include <functional>
+#include <ranges>
+
+#include <bit>
+#include <random>
+
+#include <limits>
+#include <type_traits>
+
+#include <concepts>
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Pluggable counter-based random number generation. Every engine is keyed by a secret sequence and a set of hashable objects,
+ * such that a random state can be cheaply created anywhere without sharing any state, which is deterministic and parallel-safe.
+ */
+namespace DisRegRep::Core::Random {
+
+/**
+ * @brief An engine policy creates random bit generators of a specific algorithm.
+ *
+ * @tparam P Engine policy type. It provides a key derived from a secret sequence once, and creates engines from this key and some
+ * hashable objects. Engines created from the same key and objects generate the same sequence of random numbers. It also provides a
+ * suffix to be appended to the name of the user of the engine.
+ */
+template<typename P>
+concept IsEnginePolicy = requires(const XXHash::Secret& secret, const typename P::KeyType& key, const std::uint32_t object) {
+	{ P::Suffix } -> std::convertible_to<std::string_view>;
+	{ P::makeKey(secret) } -> std::same_as<typename P::KeyType>;
+	{ P::makeEngine(key, object, object) } -> std::uniform_random_bit_generator;
+};
+
+namespace Internal_ {
+
+inline constexpr std::uint64_t GoldenGamma = 0x9E3779B97F4A7C15ULL; /**< Odd integer closest to 2^64 divided by the golden ratio. */
+
+/**
+ * @brief The finaliser of SplitMix64, which is a bijective function with good avalanche.
+ *
+ * @param x Input value.
+ *
+ * @return Mixed `x`.
+ */
+[[nodiscard]] constexpr std::uint64_t mix(std::uint64_t x) noexcept {
+	x = (x ^ x >> 30U) * 0xBF58476D1CE4E5B9ULL;
+	x = (x ^ x >> 27U) * 0x94D049BB133111EBULL;
+	return x ^ x >> 31U;
+}
+
+/**
+ * @brief Fold the bit representation of all objects into a key.
+ *
+ * @tparam Obj Object types.
+ *
+ * @param key Key to start from.
+ * @param obj Objects to be folded.
+ *
+ * @return The new key.
+ */
+template<XXHash::Hashable... Obj>
+requires(sizeof...(Obj) > 0U)
+[[nodiscard]] std::uint64_t fold(const std::uint64_t key, const Obj&... obj) noexcept {
+	using Word = std::uint64_t;
+	static constexpr std::size_t ObjectSize = (XXHash::Internal_::ObjectSize<Obj> + ...),
+		WordCount = (ObjectSize + sizeof(Word) - 1UZ) / sizeof(Word);
+
+	//Zero padding makes the trailing bytes deterministic.
+	std::array<std::byte, WordCount * sizeof(Word)> input_binary {};
+	auto begin = input_binary.begin();
+	((begin = std::ranges::copy_n(XXHash::Internal_::objectAddress(obj), XXHash::Internal_::ObjectSize<Obj>, begin).out), ...);
+	return std::ranges::fold_left(std::bit_cast<std::array<Word, WordCount>>(input_binary), key,
+		[](const Word state, const Word word) static constexpr noexcept { return mix((state + GoldenGamma) ^ word); });
+}
+
+/**
+ * @brief SplitMix64 random number generator, whose state is simply a counter scaled by the golden gamma.
+ *
+ * @param key Random key.
+ * @param counter Counter.
+ *
+ * @return Random number.
+ */
+[[nodiscard]] constexpr std::uint64_t splitMix(const std::uint64_t key, const std::uint64_t counter) noexcept {
+	return mix(key + (counter + 1U) * GoldenGamma);
+}
+
+/**
+ * @brief Squares random number generator by Widynski, which squares the counter with a key for five rounds.
+ *
+ * @param key Random key. It should have irregular bit pattern, and is made odd as required by the algorithm.
+ * @param counter Counter.
+ *
+ * @return Random number.
+ */
+[[nodiscard]] constexpr std::uint64_t squares(std::uint64_t key, const std::uint64_t counter) noexcept {
+	static constexpr auto round = [](const std::uint64_t x, const std::uint64_t addend) static constexpr noexcept {
+		return std::rotl(x * x + addend, 32);
+	};
+	key |= 1U;
+	const std::uint64_t y = counter * key, z = y + key;
+
+	std::uint64_t x = round(round(round(y, y), z), y);
+	const std::uint64_t t = x * x + z;
+	x = std::rotl(t, 32);
+	return t ^ (x * x + y) >> 32U;
+}
+
+}
+
+/**
+ * @brief A random bit generator whose output is a pure function of a key and a counter. It holds no state other than these two
+ * integers, which makes construction almost free.
+ *
+ * @tparam Function Generate a random number from a key and a counter.
+ */
+template<auto Function>
+requires std::is_invocable_r_v<std::uint64_t, decltype(Function), std::uint64_t, std::uint64_t>
+class CounterEngine {
+public:
+
+	using KeyType = std::uint64_t;
+
+	using ResultType = std::uint64_t;
+	using ResultLimit = std::numeric_limits<ResultType>;
+
+	using CounterType = std::uint_fast32_t;
+	using CounterReference = std::add_lvalue_reference_t<CounterType>;
+
+private:
+
+	KeyType Key;
+	CounterType Counter {};
+
+public:
+
+	/**
+	 * @brief Construct a counter engine.
+	 *
+	 * @param key Key that uniquely identifies the sequence of random numbers.
+	 */
+	explicit constexpr CounterEngine(const KeyType key) noexcept : Key(key) { }
+
+	[[nodiscard]] constexpr ResultType operator()() noexcept {
+		return std::invoke(Function, this->Key, this->Counter++);
+	}
+
+	[[nodiscard]] static consteval ResultType min() noexcept {
+		return ResultLimit::min();
+	}
+
+	[[nodiscard]] static consteval ResultType max() noexcept {
+		return ResultLimit::max();
+	}
+
+	/**
+	 * @brief Get the internal counter of the counter engine.
+	 *
+	 * @return The current counter.
+	 */
+	template<typename Self>
+	[[nodiscard]] constexpr std::conditional_t<std::disjunction_v<
+		std::is_rvalue_reference<Self&&>,
+		std::is_const<Self>
+	>, CounterType, CounterReference> counter(this Self&& self) noexcept {
+		return self.Counter;
+	}
+
+};
+
+/**
+ * @brief Create @link XXHash::RandomEngine, which hashes the whole secret sequence and all objects for every random number. It has
+ * the best statistical quality but is the most expensive.
+ */
+struct XXH3 {
+
+	static constexpr std::string_view Suffix {};
+
+	using KeyType = XXHash::Secret;
+
+	[[nodiscard]] static KeyType makeKey(const XXHash::Secret& secret) noexcept {
+		return secret;
+	}
+
+	//The engine refers to `key`, so `key` must outlive the engine.
+	template<XXHash::Hashable... Obj>
+	[[nodiscard]] static auto makeEngine(const KeyType& key, const Obj&... obj) noexcept {
+		return XXHash::RandomEngine(key, auto(obj)...);
+	}
+
+};
+
+/**
+ * @brief Create @link CounterEngine with a function from the key and counter to a random number. The secret sequence is hashed into
+ * a 64-bit key once, and objects are folded into this key on creation of every engine.
+ *
+ * @tparam Function Generate a random number from a key and a counter.
+ */
+template<auto Function>
+struct BasicCounterPolicy {
+
+	using KeyType = std::uint64_t;
+	using EngineType = CounterEngine<Function>;
+
+	[[nodiscard]] static KeyType makeKey(const XXHash::Secret& secret) noexcept {
+		return XXHash::hash(secret, std::tuple(Internal_::GoldenGamma));
+	}
+
+	template<XXHash::Hashable... Obj>
+	[[nodiscard]] static EngineType makeEngine(const KeyType key, const Obj&... obj) noexcept {
+		return EngineType(Internal_::fold(key, obj...));
+	}
+
+};
+
+/**
+ * @brief Create SplitMix64 engines.
+ */
+struct SplitMix : BasicCounterPolicy<Internal_::splitMix> {
+
+	static constexpr std::string_view Suffix = "-SM";
+
+};
+
+/**
+ * @brief Create Squares engines.
+ */
+struct Squares : BasicCounterPolicy<Internal_::squares> {
+
+	static constexpr std::string_view Suffix = "-SQ";
+
+};
+
+/**
+ * @brief Append the suffix of an engine policy to a name.
+ *
+ * @tparam P Engine policy.
+ * @tparam Size Size of name including the null terminator.
+ *
+ * @param name Name to be appended.
+ *
+ * @return Characters of `name` followed by the suffix of `P`, without null terminator.
+ */
+template<IsEnginePolicy P, std::size_t Size>
+[[nodiscard]] consteval std::array<char, Size - 1UZ + P::Suffix.size()> appendSuffix(const char (&name)[Size]) noexcept {
+	std::array<char, Size - 1UZ + P::Suffix.size()> qualified_name {};
+	std::ranges::copy(P::Suffix, std::ranges::copy_n(name, Size - 1UZ, qualified_name.begin()).out);
+	return qualified_name;
+}
+
+}
\ No newline at end of file
@@ -11,6 +11,13 @@
 #error Platform is unsupported.
 #endif
 
+/****************
+ * Architecture *
+ ****************/
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define DRR_CORE_SYSTEM_PLATFORM_ARCHITECTURE_X86
+#endif
+
 /************
  * Compiler *
  ************/
@@ -0,0 +1,43 @@
+#include <DisRegRep/Core/System/Processor.hpp>
+#include <DisRegRep/Core/System/Platform.hpp>
+
+#ifdef DRR_CORE_SYSTEM_PLATFORM_ARCHITECTURE_X86
+#include <cpuid.h>
+#endif
+
+#include <array>
+#include <string>
+#include <string_view>
+
+#include <algorithm>
+#include <ranges>
+
+#include <cstdint>
+
+namespace Processor = DisRegRep::Core::System::Processor;
+
+using std::array, std::string, std::string_view;
+
+string Processor::getModelName() {
+#ifdef DRR_CORE_SYSTEM_PLATFORM_ARCHITECTURE_X86
+	//The brand string is returned by three extended leaves of four registers each, padded with spaces and null.
+	static constexpr std::uint32_t BrandStringLeaf = 0x80000002U, BrandStringLeafCount = 3U;
+	if (__get_cpuid_max(0x80000000U, nullptr) >= BrandStringLeaf + BrandStringLeafCount - 1U) [[likely]] {
+		array<std::uint32_t, 4UZ * BrandStringLeafCount> brand {};
+		for (const auto leaf : std::views::iota(std::uint32_t {}, BrandStringLeafCount)) {
+			const auto reg = brand.begin() + leaf * 4U;
+			__get_cpuid(BrandStringLeaf + leaf, &reg[0], &reg[1], &reg[2], &reg[3]);
+		}
+
+		auto model = string_view(reinterpret_cast<const char*>(brand.data()), sizeof(brand));
+		model = model.substr(0UZ, model.find('\0'));
+		if (const auto first = model.find_first_not_of(' ');
+			first != string_view::npos) {
+			return string(model.substr(first, model.find_last_not_of(' ') - first + 1UZ));
+		}
+	}
+	return "x86";
+#else
+	return "Unknown";
+#endif
+}
\ No newline at end of file
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <string>
+
+/**
+ * @brief Platform-independent API for querying information of the processor.
+ */
+namespace DisRegRep::Core::System::Processor {
+
+/**
+ * @brief Get the model name of the processor that executes the calling thread.
+ *
+ * @return The brand string reported by the processor, with leading and trailing spaces removed. If the processor does not report its
+ * model name, an unspecified non-empty string identifying the architecture is returned instead.
+ */
+[[nodiscard]] std::string getModelName();
+
+}
\ No newline at end of file
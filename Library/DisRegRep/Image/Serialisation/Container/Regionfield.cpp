@@ -6,6 +6,7 @@
 #include <DisRegRep/Image/Tiff.hpp>
 
 #include <DisRegRep/Container/Regionfield.hpp>
+#include <DisRegRep/Container/RegionfieldView.hpp>
 
 #include <DisRegRep/Core/Bit.hpp>
 #include <DisRegRep/Core/Exception.hpp>
@@ -22,14 +23,18 @@
 #include <array>
 #include <span>
 
+#include <ranges>
+
 #include <cstdint>
 
-using DisRegRep::Image::Serialisation::Protocol::Implementation, DisRegRep::Container::Regionfield;
+using DisRegRep::Image::Serialisation::Protocol::Implementation,
+	DisRegRep::Container::Regionfield, DisRegRep::Container::RegionfieldView;
 using DisRegRep::Core::Bit::BitPerSampleResult, DisRegRep::Core::MdSpan::reverse;
 
 using glm::f32vec2;
 
-using std::to_array, std::span;
+using std::to_array, std::span,
+	std::views::join;
 
 namespace {
 
@@ -49,7 +54,8 @@ void Implementation<Regionfield>::initialise() {
 			.field_tag = TiffTag::RegionCount,
 			.field_readcount = 1,
 			.field_writecount = 1,
-			.field_type = TIFF_BYTE,
+			//Follow the build-time width of region identifier.
+			.field_type = sizeof(Regionfield::ValueType) == 1UZ ? TIFF_BYTE : TIFF_SHORT,
 			.field_bit = FIELD_CUSTOM,
 			.field_oktochange = true,
 			.field_name = const_cast<char*>("RegionCount")
@@ -90,7 +96,7 @@ void Implementation<Regionfield>::read(const Tiff& tif, Serialisable& regionfiel
 	}
 }
 
-void Implementation<Regionfield>::write(const Tiff& tif, const Serialisable& regionfield, const WriteInfo& write_info) {
+void Implementation<Regionfield>::write(const Tiff& tif, const RegionfieldView regionfield, const WriteInfo& write_info) {
 	using DimensionType = Serialisable::DimensionType;
 	const auto& [compression_scheme, palette_seed] = write_info;
 
@@ -98,7 +104,8 @@ void Implementation<Regionfield>::write(const Tiff& tif, const Serialisable& reg
 	DRR_ASSERT(regionfield.RegionCount > 1U);
 	const DimensionType rf_extent = regionfield.extent();
 	DRR_ASSERT(glm::all(glm::greaterThan(rf_extent, DimensionType(0U))));
-	const BitPerSampleResult bps_result = Core::Bit::minimumBitPerSample(regionfield.span());
+	const BitPerSampleResult bps_result =
+		regionfield.visitRange2d([](const auto rf_matrix) static { return Core::Bit::minimumBitPerSample(rf_matrix | join); });
 
 	Protocol::setCompressionScheme(tif, compression_scheme);
 	tif.setField(TiffTag::RegionCount, regionfield.RegionCount);
@@ -125,10 +132,11 @@ void Implementation<Regionfield>::write(const Tiff& tif, const Serialisable& reg
 	const span raw_buffer = tile_buffer.buffer();
 
 	const auto tile_extent = DimensionType(tif.getTileExtent());
-	const auto rf_matrix = regionfield.range2d();
 	const auto tile_matrix = tile_buffer.shape(decltype(tile_buffer)::EnablePacking, tile_extent, &bps_result);
-	for (const auto offset : Index::ForeachTile(rf_extent, tile_extent)) [[likely]] {
-		tile_matrix.fromMatrix(rf_matrix, offset);
-		tif.writeTile(raw_buffer, Dimension3(reverse(offset), 0U), 0U);
-	}
+	regionfield.visitRange2d([&](const auto rf_matrix) {
+		for (const auto offset : Index::ForeachTile(rf_extent, tile_extent)) [[likely]] {
+			tile_matrix.fromMatrix(rf_matrix, offset);
+			tif.writeTile(raw_buffer, Dimension3(reverse(offset), 0U), 0U);
+		}
+	});
 }
\ No newline at end of file
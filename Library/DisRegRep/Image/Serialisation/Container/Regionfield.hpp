@@ -4,6 +4,7 @@
 #include "../../Tiff.hpp"
 
 #include <DisRegRep/Container/Regionfield.hpp>
+#include <DisRegRep/Container/RegionfieldView.hpp>
 
 template<>
 struct DisRegRep::Image::Serialisation::Protocol::Implementation<DisRegRep::Container::Regionfield> {
@@ -19,6 +20,6 @@ struct DisRegRep::Image::Serialisation::Protocol::Implementation<DisRegRep::Cont
 
 	static void initialise();
 	static void read(const Tiff&, Serialisable&);
-	static void write(const Tiff&, const Serialisable&, const WriteInfo&);
+	static void write(const Tiff&, Container::RegionfieldView, const WriteInfo&);
 
 };
\ No newline at end of file
@@ -8,7 +8,10 @@
 #include <DisRegRep/Container/SplattingCoefficient.hpp>
 
 #include <DisRegRep/Core/Exception.hpp>
+#include <DisRegRep/Core/HalfPrecision.hpp>
 #include <DisRegRep/Core/MdSpan.hpp>
+#include <DisRegRep/Core/Type.hpp>
+#include <DisRegRep/Core/View/Matrix.hpp>
 
 #include <glm/vector_relational.hpp>
 #include <glm/fwd.hpp>
@@ -19,6 +22,7 @@
 
 #include <array>
 #include <span>
+#include <vector>
 
 #include <algorithm>
 #include <functional>
@@ -29,18 +33,22 @@
 #include <type_traits>
 
 #include <cmath>
+#include <cstdint>
 
 namespace Ptc = DisRegRep::Image::Serialisation::Protocol;
-using Ptc::Implementation, DisRegRep::Container::SplattingCoefficient::DenseMask;
+namespace SpltCoef = DisRegRep::Container::SplattingCoefficient;
+using Ptc::Implementation,
+	SpltCoef::BasicDense, SpltCoef::DenseMask, SpltCoef::DenseMaskFloat16, SpltCoef::DenseMaskBFloat16, SpltCoef::PlanarMask;
+using DisRegRep::Core::HalfPrecision::Float16;
 using DisRegRep::Core::MdSpan::reverse;
 
 using glm::f32vec2;
 
-using std::to_array, std::span,
+using std::to_array, std::span, std::vector,
 	std::ranges::for_each,
 	std::bind_back, std::bit_or,
 	std::views::transform, std::views::zip;
-using std::unsigned_integral, std::remove_reference_t;
+using std::unsigned_integral, std::same_as, std::remove_reference_t;
 
 namespace {
 
@@ -50,17 +58,34 @@ constexpr DisRegRep::Image::Tiff::Tag Identifier = 29716U;
 
 }
 
-template<unsigned_integral PixelType>
+//Get a 2D range of mask values of a region.
+template<typename V>
+[[nodiscard]] auto regionMatrix(const BasicDense<V>& dense_mask, const typename BasicDense<V>::IndexType region) {
+	return dense_mask.range2d() | transform(bind_back(bit_or {}, transform([region](const auto proxy) constexpr noexcept {
+		return (*proxy)[region];
+	})));
+}
+//Mask values of a region are contiguous in a planar mask, so tiles are filled without gathering from every element.
+[[nodiscard]] auto regionMatrix(const PlanarMask& planar_mask, const PlanarMask::IndexType region) {
+	return planar_mask.plane(region) | DisRegRep::Core::View::Matrix::NewAxisLeft(planar_mask.extent().y);
+}
+
+template<unsigned_integral PixelType, typename Mask>
+requires same_as<Mask, DenseMask> || same_as<Mask, PlanarMask>
+	|| same_as<Mask, DenseMaskFloat16> || same_as<Mask, DenseMaskBFloat16>
 void write(
 	const DisRegRep::Image::Tiff& tif,
 	DisRegRep::Image::Serialisation::Buffer::Tile<PixelType>& tile_buffer,
-	const DenseMask& dense_mask,
+	const Mask& dense_mask,
 	const unsigned_integral auto identifier,
 	const Implementation<DenseMask>::WriteInfo& write_info
 ) {
-	using Dimension2Type = DenseMask::Dimension2Type;
-	using Dimension3Type = DenseMask::Dimension3Type;
+	using Dimension2Type = typename Mask::Dimension2Type;
+	using Dimension3Type = typename Mask::Dimension3Type;
 	using PixelLimit = std::numeric_limits<PixelType>;
+	//Masks stored in half precision are written as is, without quantisation.
+	static constexpr bool IsHalf = !same_as<typename Mask::ValueType, DisRegRep::Core::Type::RegionMask>;
+	static_assert(!IsHalf || PixelLimit::digits == 16U);
 	const auto& [compression_scheme] = write_info;
 
 	const Dimension3Type mask_extent = dense_mask.extent();
@@ -76,7 +101,7 @@ void write(
 	tif.setResolution(f32vec2(1.0F));
 
 	//Since mask values are all unsigned normalised (i.e. [0.0, 1.0]), we can convert it to a fixed point representation.
-	tif.setField(TIFFTAG_SAMPLEFORMAT, SAMPLEFORMAT_UINT);
+	tif.setField(TIFFTAG_SAMPLEFORMAT, IsHalf ? SAMPLEFORMAT_IEEEFP : SAMPLEFORMAT_UINT);
 	tif.setField(TIFFTAG_SAMPLESPERPIXEL, 1U);
 	tif.setField(TIFFTAG_BITSPERSAMPLE, PixelLimit::digits);
 	tif.setField(TIFFTAG_PLANARCONFIG, PLANARCONFIG_CONTIG);
@@ -92,16 +117,19 @@ void write(
 	const span raw_buffer = tile_buffer.buffer();
 
 	const Dimension3Type tile_extent = tif.getTileExtent();
-	const auto mask_matrix = dense_mask.range2d();
 	const auto tile_matrix = tile_buffer.shape(remove_reference_t<decltype(tile_buffer)>::DisablePacking, Dimension2Type(tile_extent));
+	static constexpr auto quantise = [](const auto mask) static constexpr noexcept -> PixelType {
+		if constexpr (IsHalf) {
+			//There is no TIFF sample format for brain floating point; every value of it within [0.0, 1.0] is exact in binary16
+			//	except for some very small ones.
+			return Float16(static_cast<float>(mask)).bit();
+		} else {
+			return std::round(mask * PixelLimit::max());
+		}
+	};
 	for (const auto offset : DisRegRep::Image::Serialisation::Index::ForeachTile(mask_extent, tile_extent)) [[likely]] {
 		const Dimension2Type offset_xy = offset;
-		tile_matrix.fromMatrix(
-			mask_matrix | transform(bind_back(bit_or {}, transform([region = offset.z](const auto proxy) constexpr noexcept -> PixelType {
-				return std::round((*proxy)[region] * PixelLimit::max());
-			}))),
-			offset_xy
-		);
+		tile_matrix.fromMatrix(regionMatrix(dense_mask, offset.z) | transform(bind_back(bit_or {}, transform(quantise))), offset_xy);
 		//Remember to transpose the tile writing order.
 		tif.writeTile(raw_buffer, Dimension3Type(reverse(offset_xy), offset.z), 0U);
 	}
@@ -115,7 +143,8 @@ void Implementation<DenseMask>::initialise() {
 			.field_tag = TiffTag::Identifier,
 			.field_readcount = 1,
 			.field_writecount = 1,
-			.field_type = TIFF_BYTE,
+			//Follow the build-time width of region identifier.
+			.field_type = sizeof(IdentifierType) == 1UZ ? TIFF_BYTE : TIFF_SHORT,
 			.field_bit = FIELD_CUSTOM,
 			.field_oktochange = true,
 			.field_name = const_cast<char*>("Identifier")
@@ -134,6 +163,36 @@ void Implementation<DenseMask>::write(
 	::write(tif, tile_buffer, dense_mask, identifier, write_info);
 }
 
+void Implementation<DenseMask>::write(
+	const Tiff& tif,
+	const PlanarMask& planar_mask,
+	const IdentifierType identifier,
+	const WriteInfo& write_info
+) {
+	Buffer::Tile<PixelType> tile_buffer;
+	::write(tif, tile_buffer, planar_mask, identifier, write_info);
+}
+
+void Implementation<DenseMask>::write(
+	const Tiff& tif,
+	const DenseMaskFloat16& dense_mask,
+	const IdentifierType identifier,
+	const WriteInfo& write_info
+) {
+	Buffer::Tile<PixelType> tile_buffer;
+	::write(tif, tile_buffer, dense_mask, identifier, write_info);
+}
+
+void Implementation<DenseMask>::write(
+	const Tiff& tif,
+	const DenseMaskBFloat16& dense_mask,
+	const IdentifierType identifier,
+	const WriteInfo& write_info
+) {
+	Buffer::Tile<PixelType> tile_buffer;
+	::write(tif, tile_buffer, dense_mask, identifier, write_info);
+}
+
 void Implementation<DenseMask>::write(
 	const Tiff& tif,
 	const span<const Serialisable* const> dense_mask,
@@ -146,4 +205,27 @@ void Implementation<DenseMask>::write(
 		::write(tif, tile_buffer, *mask, id, write_info);
 		tif.writeDirectory();
 	});
+}
+
+void Implementation<DenseMask>::write(
+	const Tiff& tif,
+	const Serialisable& base,
+	const span<const Serialisable> reduced,
+	const IdentifierType identifier,
+	const WriteInfo& write_info
+) {
+	Buffer::Tile<PixelType> tile_buffer;
+	::write(tif, tile_buffer, base, identifier, write_info);
+	if (!reduced.empty()) {
+		//Placeholders, which are filled in by libtiff as each SubIFD is written.
+		vector<toff_t> sub_offset(reduced.size());
+		tif.setField(TIFFTAG_SUBIFD, static_cast<std::uint16_t>(sub_offset.size()), sub_offset.data());
+	}
+	tif.writeDirectory();
+
+	for_each(reduced, [&tif, &tile_buffer, identifier, &write_info](const auto& level) {
+		tif.setField(TIFFTAG_SUBFILETYPE, FILETYPE_REDUCEDIMAGE);
+		::write(tif, tile_buffer, level, identifier, write_info);
+		tif.writeDirectory();
+	});
 }
\ No newline at end of file
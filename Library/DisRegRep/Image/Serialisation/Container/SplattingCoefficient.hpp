@@ -4,6 +4,7 @@
 #include "../../Tiff.hpp"
 
 #include <DisRegRep/Container/SplattingCoefficient.hpp>
+#include <DisRegRep/Core/Type.hpp>
 
 #include <span>
 
@@ -18,7 +19,7 @@ struct DisRegRep::Image::Serialisation::Protocol::Implementation<DisRegRep::Cont
 
 	using Serialisable = Container::SplattingCoefficient::DenseMask;
 	using PixelType = std::uint16_t;
-	using IdentifierType = std::uint_fast8_t;
+	using IdentifierType = Core::Type::RegionIdentifier;
 
 	struct WriteInfo {
 
@@ -28,6 +29,13 @@ struct DisRegRep::Image::Serialisation::Protocol::Implementation<DisRegRep::Cont
 
 	static void initialise();
 	static void write(const Tiff&, const Serialisable&, IdentifierType, const WriteInfo&);
+	//Write a planar mask in the same format as a dense mask.
+	static void write(const Tiff&, const Container::SplattingCoefficient::PlanarMask&, IdentifierType, const WriteInfo&);
+	//Write a half precision mask as 16-bit IEEE floating points rather than fixed points.
+	static void write(const Tiff&, const Container::SplattingCoefficient::DenseMaskFloat16&, IdentifierType, const WriteInfo&);
+	static void write(const Tiff&, const Container::SplattingCoefficient::DenseMaskBFloat16&, IdentifierType, const WriteInfo&);
 	static void write(const Tiff&, std::span<const Serialisable* const>, std::span<const IdentifierType>, const WriteInfo&);
+	//Write the base level to the current directory, followed by every reduced level as a SubIFD of it, then advance the directory.
+	static void write(const Tiff&, const Serialisable&, std::span<const Serialisable>, IdentifierType, const WriteInfo&);
 
 };
\ No newline at end of file
@@ -1,6 +1,6 @@
 #include <DisRegRep/Splatting/Base.hpp>
 
-#include <DisRegRep/Container/Regionfield.hpp>
+#include <DisRegRep/Container/RegionfieldView.hpp>
 #include <DisRegRep/Core/Exception.hpp>
 #include <DisRegRep/Core/XXHash.hpp>
 
@@ -8,16 +8,20 @@
 
 namespace XXHash = DisRegRep::Core::XXHash;
 using DisRegRep::Splatting::Base,
-	DisRegRep::Container::Regionfield;
+	DisRegRep::Container::RegionfieldView;
 
 using glm::all, glm::greaterThanEqual, glm::lessThanEqual;
 
-void Base::validate(const InvokeInfo& invoke_info, const Regionfield& regionfield) const {
-	const auto [offset, extent] = invoke_info;
-	const Regionfield::DimensionType rf_extent = regionfield.extent();
+void Base::validate(const InvokeInfo& invoke_info, const RegionfieldView regionfield) const {
+	const auto [offset, extent, boundary, _] = invoke_info;
+	const RegionfieldView::DimensionType rf_extent = regionfield.extent();
 
 	DRR_ASSERT(regionfield.RegionCount > 0U);
 	DRR_ASSERT(all(greaterThanEqual(rf_extent, this->minimumRegionfieldDimension(invoke_info))));
+	//Elements outside the regionfield are resolved by the boundary mode, so only the splatting area itself needs to be inside.
+	if (boundary != BoundaryMode::None) {
+		return;
+	}
 	DRR_ASSERT(all(greaterThanEqual(offset, this->minimumOffset())));
 	DRR_ASSERT(all(lessThanEqual(extent, this->maximumExtent(regionfield, offset))));
 }
@@ -30,16 +34,15 @@ XXHash::Secret Base::generateSecret(const SeedType seed) {
 }
 
 Base::DimensionType Base::minimumRegionfieldDimension(const InvokeInfo& invoke_info) const {
-	const auto [offset, extent] = invoke_info;
-	return offset + extent;
+	return invoke_info.Offset + invoke_info.Extent;
 }
 
 Base::DimensionType Base::minimumOffset() const {
 	return DimensionType(0U);
 }
 
-Base::DimensionType Base::maximumExtent(const Regionfield& regionfield, const DimensionType offset) const {
-	const Regionfield::DimensionType rf_extent = regionfield.extent();
+Base::DimensionType Base::maximumExtent(const RegionfieldView regionfield, const DimensionType offset) const {
+	const RegionfieldView::DimensionType rf_extent = regionfield.extent();
 	DRR_ASSERT(all(greaterThanEqual(rf_extent, offset)));
 	return rf_extent - offset;
 }
\ No newline at end of file
@@ -2,7 +2,7 @@
 
 #include "Container.hpp"
 
-#include <DisRegRep/Container/Regionfield.hpp>
+#include <DisRegRep/Container/RegionfieldView.hpp>
 #include <DisRegRep/Container/SplattingCoefficient.hpp>
 
 #include <DisRegRep/Core/XXHash.hpp>
@@ -10,9 +10,12 @@
 #include <any>
 #include <string_view>
 
+#include <algorithm>
+
 #include <type_traits>
 
 #include <cstddef>
+#include <cstdint>
 
 //Declare `DisRegRep::Splatting::Base::sizeByte`.
 #define DRR_SPLATTING_DECLARE_SIZE_BYTE(PREFIX, QUAL, SUFFIX) \
@@ -25,14 +28,21 @@
 	DRR_SPLATTING_CONTAINER_TRAIT(KERNEL, OUTPUT)::MaskOutputType& QUAL operator()( \
 		const DRR_SPLATTING_CONTAINER_TRAIT(KERNEL, OUTPUT) container_trait, \
 		const DisRegRep::Splatting::Base::InvokeInfo& invoke_info, \
-		const DisRegRep::Container::Regionfield& regionfield, \
+		const DisRegRep::Container::RegionfieldView regionfield, \
 		std::any& memory \
 	) const
 //Do `DRR_SPLATTING_DECLARE_FUNCTOR` for every valid combination of container implementations.
 #define DRR_SPLATTING_DECLARE_FUNCTOR_ALL(PREFIX, SUFFIX) \
 	PREFIX DRR_SPLATTING_DECLARE_FUNCTOR(, Dense, Dense) SUFFIX; \
 	PREFIX DRR_SPLATTING_DECLARE_FUNCTOR(, Dense, Sparse) SUFFIX; \
-	PREFIX DRR_SPLATTING_DECLARE_FUNCTOR(, Sparse, Sparse) SUFFIX
+	PREFIX DRR_SPLATTING_DECLARE_FUNCTOR(, Sparse, Sparse) SUFFIX; \
+	PREFIX DRR_SPLATTING_DECLARE_FUNCTOR(, Fixed4, Dense) SUFFIX; \
+	PREFIX DRR_SPLATTING_DECLARE_FUNCTOR(, Fixed8, Dense) SUFFIX; \
+	PREFIX DRR_SPLATTING_DECLARE_FUNCTOR(, Fixed16, Dense) SUFFIX; \
+	PREFIX DRR_SPLATTING_DECLARE_FUNCTOR(, Dense, Planar) SUFFIX; \
+	PREFIX DRR_SPLATTING_DECLARE_FUNCTOR(, Sparse, CompactSparse) SUFFIX; \
+	PREFIX DRR_SPLATTING_DECLARE_FUNCTOR(, Sparse, QuantisedSparse) SUFFIX; \
+	PREFIX DRR_SPLATTING_DECLARE_FUNCTOR(, Sparse, TopK4) SUFFIX
 //Do `DRR_SPLATTING_DECLARE_FUNCTOR_ALL` with the correct fixes for splatting implementations.
 #define DRR_SPLATTING_DECLARE_FUNCTOR_ALL_IMPL DRR_SPLATTING_DECLARE_FUNCTOR_ALL(, override)
 
@@ -42,7 +52,7 @@
 	template<DisRegRep::Splatting::Container::IsTrait ContainerTrait> \
 	FUNC_QUAL ContainerTrait::MaskOutputType& QUAL invokeImpl( \
 		const DisRegRep::Splatting::Base::InvokeInfo& invoke_info, \
-		const DisRegRep::Container::Regionfield& regionfield, \
+		const DisRegRep::Container::RegionfieldView regionfield, \
 		std::any& memory \
 	) const
 //Do `DRR_SPLATTING_DECLARE_DELEGATING_FUNCTOR` with the correct qualifier for splatting implementations.
@@ -74,10 +84,26 @@ public:
 	using SeedType = Core::XXHash::SeedType;
 	using SizeType = std::size_t;
 
+	/**
+	 * @brief Specify how elements outside the regionfield are addressed when they are covered by the splatting.
+	 */
+	enum class BoundaryMode : std::uint_fast8_t {
+		None, /**< No element outside the regionfield is addressed; the application should adjust offset and extent instead. */
+		Clamp, /**< Repeat the element on the nearest edge. */
+		Mirror, /**< Reflect about the edge, including the edge element itself. */
+		Wrap /**< Repeat the whole regionfield periodically, such that splatting output is tileable. */
+	};
+
 	struct InvokeInfo {
 
 		DimensionType Offset, /**< Coordinate of the first point on the regionfield included for splatting. */
 			Extent; /**< Extent covering the area on the regionfield where splatting are performed. */
+		BoundaryMode Boundary = BoundaryMode::None; /**< Boundary mode for elements outside the regionfield. */
+		/**
+		 * @brief Emit entries of every sparse mask in ascending order of region identifier, such that a sparse output does not need to
+		 * be sorted afterwards. Masks of a dense output are always in order.
+		 */
+		bool Sorted = false;
 
 	};
 
@@ -89,7 +115,7 @@ protected:
 	 * @param invoke_info @link InvokeInfo.
 	 * @param regionfield Regionfield used for splatting.
 	 */
-	virtual void validate(const InvokeInfo&, const DisRegRep::Container::Regionfield&) const;
+	virtual void validate(const InvokeInfo&, DisRegRep::Container::RegionfieldView) const;
 
 	/**
 	 * @brief Generate a secret sequence from a seed to be used by derived splatting for random number generation.
@@ -100,6 +126,44 @@ protected:
 	 */
 	[[nodiscard]] static Core::XXHash::Secret generateSecret(SeedType);
 
+	/**
+	 * @brief Resolve a coordinate on one axis of the regionfield that may be outside the regionfield.
+	 *
+	 * @param boundary Boundary mode.
+	 * @param coordinate Coordinate to be resolved.
+	 * @param size Size of the regionfield on this axis.
+	 *
+	 * @return Coordinate within the regionfield. If `boundary` is @link BoundaryMode::None, `coordinate` is returned unchanged.
+	 */
+	[[nodiscard]] static constexpr DimensionType::value_type resolve(
+		const BoundaryMode boundary,
+		const std::make_signed_t<DimensionType::value_type> coordinate,
+		const DimensionType::value_type size
+	) noexcept {
+		using ValueType = DimensionType::value_type;
+		using SignedType = std::make_signed_t<ValueType>;
+		const auto n = static_cast<SignedType>(size);
+		const auto modulo = [](const SignedType a, const SignedType b) static constexpr noexcept { return (a % b + b) % b; };
+
+		//Every boundary mode leaves a coordinate inside the regionfield unchanged, so only the halo needs to be resolved.
+		if (coordinate >= 0 && coordinate < n) [[likely]] {
+			return static_cast<ValueType>(coordinate);
+		}
+		switch (boundary) {
+		case BoundaryMode::Clamp: return static_cast<ValueType>(std::ranges::clamp(coordinate, SignedType {}, n - 1));
+		case BoundaryMode::Mirror:
+			//Reflection has a period of twice the size.
+			if (const SignedType m = modulo(coordinate, 2 * n);
+				m < n) {
+				return static_cast<ValueType>(m);
+			} else {
+				return static_cast<ValueType>(2 * n - 1 - m);
+			}
+		case BoundaryMode::Wrap: return static_cast<ValueType>(modulo(coordinate, n));
+		default: [[likely]] return static_cast<ValueType>(coordinate);
+		}
+	}
+
 public:
 
 	constexpr Base() noexcept = default;
@@ -155,7 +219,7 @@ public:
 	 *
 	 * @return Maximum splatting extent for @link InvokeInfo::Extent.
 	 */
-	[[nodiscard]] virtual DimensionType maximumExtent(const DisRegRep::Container::Regionfield&, DimensionType) const;
+	[[nodiscard]] virtual DimensionType maximumExtent(DisRegRep::Container::RegionfieldView, DimensionType) const;
 
 	/**
 	 * @brief Query the usage of scratch memory.
@@ -170,11 +234,14 @@ public:
 
 	/**
 	 * @brief Invoke to compute region feature splatting coefficients on a given regionfield. The splatting does not need to
-	 * perform boundary checking, and the application should adjust offset to handle potential out-of-bound access.
+	 * perform boundary checking, and the application should adjust offset to handle potential out-of-bound access, unless a
+	 * @link BoundaryMode is specified in `invoke_info`, in which case elements outside the regionfield are resolved by the
+	 * splatting without copying the regionfield.
 	 *
 	 * @param container_trait Specify the container trait.
 	 * @param invoke_info @link InvokeInfo.
-	 * @param regionfield Splatting coefficients are computed for this regionfield.
+	 * @param regionfield Splatting coefficients are computed for this regionfield. It can be a view of a regionfield with arbitrary
+	 * strides, such as a crop or a transpose, or of a packed regionfield, which is splatted without copying or unpacking.
 	 * @param memory The scratch memory to be used in this invocation. The type is erased to allow implementation-defined behaviours.
 	 * It is recommended to use the same memory instance across different invocation with the same `container_trait` to enable memory
 	 * reuse. Otherwise, existing contents captured in `memory` will be destroyed if it does not contain a valid type used by the
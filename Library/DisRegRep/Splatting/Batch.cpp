@@ -0,0 +1,48 @@
+#include <DisRegRep/Splatting/Batch.hpp>
+#include <DisRegRep/Splatting/Base.hpp>
+
+#include <DisRegRep/Core/ThreadPool.hpp>
+
+#include <any>
+
+#include <algorithm>
+#include <functional>
+#include <ranges>
+
+#include <exception>
+
+using DisRegRep::Splatting::Batch, DisRegRep::Splatting::Base,
+	DisRegRep::Core::ThreadPool;
+
+using std::any;
+using std::ranges::fold_left, std::ranges::for_each,
+	std::plus,
+	std::views::filter, std::views::transform;
+using std::exception_ptr, std::current_exception, std::rethrow_exception;
+
+Batch::Batch() : Memory(1U) { }
+
+Batch::Batch(ThreadPool& thread_pool) : ThreadPool(&thread_pool), Memory(thread_pool.sizeThread()) { }
+
+void Batch::synchronise() {
+	exception_ptr e_ptr;
+	for_each(this->Future, [&e_ptr](auto& fut) {
+		try {
+			fut.get();
+		} catch (...) {
+			if (!e_ptr) [[unlikely]] {
+				e_ptr = current_exception();
+			}
+		}
+	});
+	this->Future.clear();
+
+	if (e_ptr) [[unlikely]] {
+		rethrow_exception(e_ptr);
+	}
+}
+
+Batch::SizeType Batch::sizeByte(const Base& splatting) const {
+	return fold_left(this->Memory | filter([](const any& memory) static noexcept { return memory.has_value(); })
+		| transform([&splatting](const any& memory) { return splatting.sizeByte(memory); }), SizeType {}, plus {});
+}
\ No newline at end of file
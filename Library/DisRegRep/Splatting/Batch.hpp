@@ -0,0 +1,134 @@
+#pragma once
+
+#include "Base.hpp"
+#include "Container.hpp"
+
+#include <DisRegRep/Container/Regionfield.hpp>
+#include <DisRegRep/Core/ThreadPool.hpp>
+
+#include <vector>
+
+#include <any>
+#include <span>
+#include <tuple>
+
+#include <functional>
+#include <iterator>
+#include <ranges>
+
+#include <future>
+
+#include <concepts>
+
+namespace DisRegRep::Splatting {
+
+/**
+ * @brief Invoke a splatting over a batch of regionfields, either sequentially or with a thread pool. Each thread owns a scratch memory
+ * that is reused across every regionfield processed by that thread, as well as across batches, such that allocation only happens when
+ * the scratch memory needs to grow. An executor is therefore meant to be long-lived rather than created for every batch.
+ */
+class Batch {
+public:
+
+	using SizeType = Base::SizeType;
+
+private:
+
+	Core::ThreadPool* ThreadPool {};
+
+	std::vector<std::any> Memory; /**< Indexed by thread index of the pool, or a single one if sequential. */
+	std::vector<std::future<void>> Future;
+
+	//Wait for all tasks of the current batch to finish, and rethrow the first exception encountered, if any.
+	void synchronise();
+
+public:
+
+	/**
+	 * @brief Create a batch splatting executor that processes every regionfield on the calling thread.
+	 */
+	Batch();
+
+	/**
+	 * @brief Create a batch splatting executor.
+	 *
+	 * @param thread_pool Thread pool where batch splatting is distributed to. The thread pool must outlive this executor, and
+	 * must not be used to invoke this executor, or it deadlocks.
+	 */
+	explicit Batch(Core::ThreadPool&);
+
+	Batch(const Batch&) = delete;
+
+	Batch(Batch&&) noexcept = default;
+
+	Batch& operator=(const Batch&) = delete;
+
+	Batch& operator=(Batch&&) noexcept = default;
+
+	~Batch() = default;
+
+	/**
+	 * @brief Query the total scratch memory usage held by all threads.
+	 *
+	 * @param splatting Splatting method that has been used by this executor for at least one batch. Using the same executor with
+	 * different splatting methods is allowed, but only the scratch memory of the most recently used one is kept.
+	 *
+	 * @return Total memory usage in bytes.
+	 *
+	 * @exception std::bad_any_cast If scratch memory was last used by a different splatting method than `splatting`.
+	 */
+	[[nodiscard]] SizeType sizeByte(const Base&) const;
+
+	/**
+	 * @brief Compute region feature splatting coefficients for every regionfield in a batch.
+	 *
+	 * @tparam ContainerTrait Container trait of the splatting.
+	 * @tparam S Type of output sink.
+	 *
+	 * @param splatting Splatting method.
+	 * @param container_trait Specify the container trait.
+	 * @param invoke_info @link Base::InvokeInfo shared by all regionfields in the batch.
+	 * @param regionfield Batch of regionfields.
+	 * @param sink Invoked with the index of the regionfield in `regionfield` and the splatting output of it, on the thread that
+	 * computes it. The output is only valid during the invocation, because its memory will be reused by the next regionfield
+	 * processed by the same thread. `sink` is called concurrently if this executor has a thread pool, but never twice with the same
+	 * index.
+	 *
+	 * @exception Any exception thrown by `splatting` or `sink` is rethrown once the whole batch is finished, or propagated immediately if
+	 * this executor is sequential.
+	 */
+	template<Container::IsTrait ContainerTrait, typename S>
+	requires std::invocable<S&, SizeType, typename ContainerTrait::MaskOutputType&>
+	void operator()(
+		const Base& splatting,
+		ContainerTrait,
+		const Base::InvokeInfo& invoke_info,
+		const std::span<const DisRegRep::Container::Regionfield> regionfield,
+		S& sink
+	) {
+		using std::tuple, std::invoke,
+			std::back_inserter,
+			std::views::iota, std::views::transform;
+
+		if (!this->ThreadPool) {
+			for (auto& memory = this->Memory.front();
+				const SizeType index : iota(SizeType {}, regionfield.size())) {
+				invoke(sink, index, splatting(ContainerTrait {}, invoke_info, regionfield[index], memory));
+			}
+			return;
+		}
+
+		this->Future.reserve(regionfield.size());
+		this->ThreadPool->enqueue(iota(SizeType {}, regionfield.size()) | transform(
+			[&splatting, &invoke_info, regionfield, &sink, &memory = this->Memory](const SizeType index) {
+				return tuple([&splatting, &invoke_info, regionfield, &sink, &memory, index](
+					const Core::ThreadPool::ThreadInfo& thread_info) -> void {
+					invoke(sink, index, splatting(ContainerTrait {}, invoke_info, regionfield[index], memory[thread_info.Index]));
+				});
+			}), back_inserter(this->Future));
+		this->synchronise();
+	}
+
+};
+
+}
\ No newline at end of file
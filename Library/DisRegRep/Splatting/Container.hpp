@@ -8,11 +8,13 @@
 #include <tuple>
 
 #include <algorithm>
+#include <functional>
 
 #include <utility>
 
 #include <type_traits>
 
+#include <cstddef>
 #include <cstdint>
 
 //Get a fully qualified splatting container trait.
@@ -32,9 +34,42 @@ namespace DisRegRep::Splatting::Container {
  */
 enum class Implementation : std::uint_fast8_t {
 	Dense = 0x00U, /**< Use dense matrix to implement the container. */
+	//Fixed implementations have their capacity as the underlying value.
+	Fixed4 = 0x04U, /**< Use a dense array of capacity 4 to implement the container. Only available for kernel. */
+	Fixed8 = 0x08U, /**< Use a dense array of capacity 8 to implement the container. Only available for kernel. */
+	Fixed16 = 0x10U, /**< Use a dense array of capacity 16 to implement the container. Only available for kernel. */
+	Planar = 0x20U, /**< Use dense matrix stored region by region to implement the container. Only available for output. */
+	TopK4 = 0xFCU, /**< Use top-K matrix that keeps 4 greatest coefficients to implement the container. Only available for output. */
+	//Compact implementations are sparse matrices whose region identifiers and values are stored separately.
+	QuantisedSparse = 0xFDU, /**< Use compact sparse matrix with 16-bit values to implement the container. Only available for output. */
+	CompactSparse = 0xFEU, /**< Use compact sparse matrix to implement the container. Only available for output. */
 	Sparse = 0xFFU /**< Use sparse matrix to implement the container. */
 };
 
+/**
+ * @brief Determine if a container implementation has a capacity fixed at compile time.
+ *
+ * @param impl Container implementation.
+ *
+ * @return True if `impl` is fixed.
+ */
+[[nodiscard]] constexpr bool isFixed(const Implementation impl) noexcept {
+	using enum Implementation;
+	return impl == Fixed4 || impl == Fixed8 || impl == Fixed16;
+}
+
+/**
+ * @brief Determine if a container implementation can only be used for the output.
+ *
+ * @param impl Container implementation.
+ *
+ * @return True if `impl` is output only.
+ */
+[[nodiscard]] constexpr bool isOutputOnly(const Implementation impl) noexcept {
+	using enum Implementation;
+	return impl == Planar || impl == TopK4 || impl == QuantisedSparse || impl == CompactSparse;
+}
+
 /**
  * @brief Get a representative name of the container implementation enum.
  *
@@ -46,6 +81,13 @@ enum class Implementation : std::uint_fast8_t {
 	using enum Implementation;
 	switch (impl) {
 	case Dense: return "D";
+	case Fixed4: return "F4";
+	case Fixed8: return "F8";
+	case Fixed16: return "F16";
+	case Planar: return "P";
+	case TopK4: return "T4";
+	case QuantisedSparse: return "QS";
+	case CompactSparse: return "CS";
 	case Sparse: return "S";
 	default: std::unreachable();
 	}
@@ -57,49 +99,102 @@ enum class Implementation : std::uint_fast8_t {
  * @tparam Kernel Container implementation of the splatting kernel.
  * @tparam Output Container implementation of the computed coefficients.
  */
-template<Implementation Kernel, Implementation Output>
-struct Trait {
-private:
+namespace Internal_ {
 
-	template<Implementation Impl, typename Dense, typename Sparse>
-	using SwitchContainer = std::conditional_t<Impl == Implementation::Dense, Dense, Sparse>;
+template<Implementation Impl>
+struct KernelContainer {
 
-public:
+	using Type = DisRegRep::Container::SplatKernel::Fixed<std::to_underlying(Impl)>;
+
+};
+template<>
+struct KernelContainer<Implementation::Dense> {
+
+	using Type = DisRegRep::Container::SplatKernel::Dense;
+
+};
+template<>
+struct KernelContainer<Implementation::Sparse> {
+
+	using Type = DisRegRep::Container::SplatKernel::Sparse;
+
+};
+
+template<Implementation Impl>
+struct OutputContainer;
+template<>
+struct OutputContainer<Implementation::Dense> {
+
+	using ImportanceType = DisRegRep::Container::SplattingCoefficient::DenseImportance;
+	using MaskType = DisRegRep::Container::SplattingCoefficient::DenseMask;
+
+};
+template<>
+struct OutputContainer<Implementation::Planar> {
+
+	//Importance is only used as intermediate storage, so it does not benefit from a planar layout.
+	using ImportanceType = DisRegRep::Container::SplattingCoefficient::DenseImportance;
+	using MaskType = DisRegRep::Container::SplattingCoefficient::PlanarMask;
+
+};
+template<>
+struct OutputContainer<Implementation::Sparse> {
+
+	using ImportanceType = DisRegRep::Container::SplattingCoefficient::SparseImportance;
+	using MaskType = DisRegRep::Container::SplattingCoefficient::SparseMask;
+
+};
+template<>
+struct OutputContainer<Implementation::TopK4> {
+
+	//Importance is an intermediate sum over every region, which must not be truncated.
+	using ImportanceType = DisRegRep::Container::SplattingCoefficient::SparseImportance;
+	using MaskType = DisRegRep::Container::SplattingCoefficient::TopKMask<4U>;
+
+};
+template<>
+struct OutputContainer<Implementation::QuantisedSparse> {
+
+	using ImportanceType = DisRegRep::Container::SplattingCoefficient::SparseImportance;
+	using MaskType = DisRegRep::Container::SplattingCoefficient::QuantisedSparseMask;
+
+};
+template<>
+struct OutputContainer<Implementation::CompactSparse> {
+
+	using ImportanceType = DisRegRep::Container::SplattingCoefficient::SparseImportance;
+	using MaskType = DisRegRep::Container::SplattingCoefficient::CompactSparseMask;
+
+};
+
+}
+
+template<Implementation Kernel, Implementation Output>
+requires(!isOutputOnly(Kernel) && !isFixed(Output))
+struct Trait {
 
 	static constexpr Implementation KernelImplementation = Kernel,
 		OutputImplementation = Output;
 
 private:
 
-	static constexpr auto TagCharacter = std::apply(
-		[](const auto... impl) static consteval {
-			using std::array, std::string_view, std::ranges::copy;
+	static constexpr auto TagCharacter = [] static consteval {
+		using std::array, std::string_view, std::ranges::copy;
+
+		array<string_view::value_type, tag(KernelImplementation).size() + tag(OutputImplementation).size()> ch {};
+		copy(tag(OutputImplementation), copy(tag(KernelImplementation), ch.begin()).out);
+		return ch;
+	}();
 
-			array<string_view::value_type, sizeof...(impl)> ch {};
-			auto it = ch.begin();
-			((it = copy(tag(impl), it).out), ...);
-			return ch;
-		}, std::tuple(KernelImplementation, OutputImplementation));
+	using OutputContainer = Internal_::OutputContainer<OutputImplementation>;
 
 public:
 
 	static constexpr auto Tag = std::string_view(TagCharacter); /**< Just a string representation of this container trait. */
 
-	using KernelType = SwitchContainer<
-		KernelImplementation,
-		DisRegRep::Container::SplatKernel::Dense,
-		DisRegRep::Container::SplatKernel::Sparse
-	>; /**< Container type of the splatting kernel. */
-	using ImportanceOutputType = SwitchContainer<
-		OutputImplementation,
-		DisRegRep::Container::SplattingCoefficient::DenseImportance,
-		DisRegRep::Container::SplattingCoefficient::SparseImportance
-	>; /**< Container type of the output that stores region importance. */
-	using MaskOutputType = SwitchContainer<
-		OutputImplementation,
-		DisRegRep::Container::SplattingCoefficient::DenseMask,
-		DisRegRep::Container::SplattingCoefficient::SparseMask
-	>; /**< Container type of the output that stores region mask. */
+	using KernelType = typename Internal_::KernelContainer<KernelImplementation>::Type; /**< Container type of the splatting kernel. */
+	using ImportanceOutputType = typename OutputContainer::ImportanceType; /**< Container type of the output that stores region importance. */
+	using MaskOutputType = typename OutputContainer::MaskType; /**< Container type of the output that stores region mask. */
 
 };
 
@@ -107,14 +202,43 @@ public:
 inline constexpr DRR_SPLATTING_CONTAINER_TRAIT(Dense, Dense) DenseKernelDenseOutputTrait;
 inline constexpr DRR_SPLATTING_CONTAINER_TRAIT(Dense, Sparse) DenseKernelSparseOutputTrait;
 inline constexpr DRR_SPLATTING_CONTAINER_TRAIT(Sparse, Sparse) SparseKernelSparseOutputTrait;
+inline constexpr DRR_SPLATTING_CONTAINER_TRAIT(Fixed4, Dense) Fixed4KernelDenseOutputTrait;
+inline constexpr DRR_SPLATTING_CONTAINER_TRAIT(Fixed8, Dense) Fixed8KernelDenseOutputTrait;
+inline constexpr DRR_SPLATTING_CONTAINER_TRAIT(Fixed16, Dense) Fixed16KernelDenseOutputTrait;
+inline constexpr DRR_SPLATTING_CONTAINER_TRAIT(Dense, Planar) DenseKernelPlanarOutputTrait;
+inline constexpr DRR_SPLATTING_CONTAINER_TRAIT(Sparse, CompactSparse) SparseKernelCompactSparseOutputTrait;
+inline constexpr DRR_SPLATTING_CONTAINER_TRAIT(Sparse, QuantisedSparse) SparseKernelQuantisedSparseOutputTrait;
+inline constexpr DRR_SPLATTING_CONTAINER_TRAIT(Sparse, TopK4) SparseKernelTopK4OutputTrait;
 
-//All valid container trait combinations.
+//All container trait combinations that accept a regionfield of any region count.
 inline constexpr auto Combination = std::tuple(
 	DenseKernelDenseOutputTrait,
 	DenseKernelSparseOutputTrait,
 	SparseKernelSparseOutputTrait
 );
 using CombinationType = decltype(Combination);
+//All container trait combinations with a fixed kernel, which only accept a regionfield whose region count is within the capacity.
+inline constexpr auto FixedCombination = std::tuple(
+	Fixed4KernelDenseOutputTrait,
+	Fixed8KernelDenseOutputTrait,
+	Fixed16KernelDenseOutputTrait
+);
+//All container trait combinations with a planar output, for consumers that process one region at a time.
+inline constexpr auto PlanarCombination = std::tuple(
+	DenseKernelPlanarOutputTrait
+);
+//All container trait combinations with a compact sparse output, which trade a few more instructions per write for less memory.
+inline constexpr auto CompactCombination = std::tuple(
+	SparseKernelCompactSparseOutputTrait,
+	SparseKernelQuantisedSparseOutputTrait
+);
+//All container trait combinations with a top-K output, which only keeps the greatest coefficients of every element.
+inline constexpr auto TopKCombination = std::tuple(
+	SparseKernelTopK4OutputTrait
+);
+//All valid container trait combinations.
+inline constexpr auto AllCombination =
+	std::tuple_cat(Combination, FixedCombination, PlanarCombination, CompactCombination, TopKCombination);
 
 /**
  * `Tr` is a container trait.
@@ -122,4 +246,34 @@ using CombinationType = decltype(Combination);
 template<typename Tr>
 concept IsTrait = std::is_same_v<Tr, Trait<Tr::KernelImplementation, Tr::OutputImplementation>>;
 
+/**
+ * @brief Select a container trait with dense output for a given region count, that is, the one with the smallest fixed kernel that
+ * holds every region, or a dense kernel if no fixed kernel is large enough.
+ *
+ * @tparam F Type of function.
+ *
+ * @param region_count Number of region of the regionfield to be splatted.
+ * @param f Invoked with the selected container trait.
+ *
+ * @return The return value of `f`, which must be the same for every container trait.
+ */
+template<typename F>
+decltype(auto) dispatchDenseOutput(const std::size_t region_count, F&& f) {
+	using std::invoke;
+	using Fixed4Trait = std::remove_const_t<decltype(Fixed4KernelDenseOutputTrait)>;
+	using Fixed8Trait = std::remove_const_t<decltype(Fixed8KernelDenseOutputTrait)>;
+	using Fixed16Trait = std::remove_const_t<decltype(Fixed16KernelDenseOutputTrait)>;
+
+	if (region_count <= Fixed4Trait::KernelType::Capacity) {
+		return invoke(std::forward<F>(f), Fixed4KernelDenseOutputTrait);
+	}
+	if (region_count <= Fixed8Trait::KernelType::Capacity) {
+		return invoke(std::forward<F>(f), Fixed8KernelDenseOutputTrait);
+	}
+	if (region_count <= Fixed16Trait::KernelType::Capacity) {
+		return invoke(std::forward<F>(f), Fixed16KernelDenseOutputTrait);
+	}
+	return invoke(std::forward<F>(f), DenseKernelDenseOutputTrait);
+}
+
 }
\ No newline at end of file
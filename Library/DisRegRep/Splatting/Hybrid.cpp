@@ -0,0 +1,117 @@
+#include <DisRegRep/Splatting/Hybrid.hpp>
+#include <DisRegRep/Splatting/Base.hpp>
+
+#include <DisRegRep/Container/RegionfieldView.hpp>
+#include <DisRegRep/Core/Exception.hpp>
+
+#include <glm/common.hpp>
+#include <glm/vector_relational.hpp>
+
+#include <any>
+#include <array>
+#include <span>
+#include <variant>
+
+#include <algorithm>
+#include <functional>
+#include <ranges>
+
+#include <utility>
+
+#include <cmath>
+
+using DisRegRep::Splatting::Hybrid, DisRegRep::Splatting::Base,
+	DisRegRep::Container::RegionfieldView;
+
+using std::any, std::array, std::span, std::visit, std::holds_alternative, std::get;
+using std::ranges::fold_left, std::ranges::fill,
+	std::plus,
+	std::views::iota, std::views::filter, std::views::transform;
+
+namespace {
+
+//Take the output out of the scratch memory, such that the scratch memory receives the old output of the tile, which will be resized
+//	at the next invocation anyway.
+template<typename Trait>
+void swapOutput(Hybrid::OutputType& tile_output, typename Trait::MaskOutputType& output) {
+	using OutputType = typename Trait::MaskOutputType;
+	if (!holds_alternative<OutputType>(tile_output)) {
+		tile_output.emplace<OutputType>();
+	}
+	std::ranges::swap(get<OutputType>(tile_output), output);
+}
+
+}
+
+bool Hybrid::isDense(const Base& splatting, const Base::InvokeInfo& invoke_info, const RegionfieldView regionfield) {
+	const auto [offset, extent, _1, _2] = invoke_info;
+	const DimensionType minimum_offset = splatting.minimumOffset(),
+		footprint_extent = splatting.minimumRegionfieldDimension({
+			.Offset = minimum_offset,
+			.Extent = extent
+		}),
+		//Footprint outside the regionfield is addressed by boundary mode, which only repeats regions inside the regionfield.
+		footprint_offset = offset - glm::min(offset, minimum_offset),
+		footprint_end = glm::min(offset - minimum_offset + footprint_extent, DimensionType(regionfield.extent()));
+	const auto threshold = static_cast<RegionfieldView::IndexType>(std::ceil(this->DenseThreshold * regionfield.RegionCount));
+
+	this->Presence.resize(regionfield.RegionCount);
+	fill(this->Presence, false);
+	return regionfield.visitRange2d([&](const auto rf_2d) {
+		RegionfieldView::IndexType distinct {};
+		//Stop as soon as the threshold is reached, so highly diverse tiles do not need to be scanned completely.
+		for (const auto x : iota(footprint_offset.x, footprint_end.x)) {
+			const auto rf_row = rf_2d[x];
+			for (const auto y : iota(footprint_offset.y, footprint_end.y)) {
+				if (const auto region_id = rf_row[y];
+					!this->Presence[region_id]) [[unlikely]] {
+					this->Presence[region_id] = true;
+					if (++distinct >= threshold) {
+						return true;
+					}
+				}
+			}
+		}
+		return false;
+	});
+}
+
+Hybrid::SizeType Hybrid::sizeByte(const Base& splatting) const {
+	const auto memory_size = fold_left(array { &this->DenseMemory, &this->SparseMemory }
+		| filter([](const any* const memory) static noexcept { return memory->has_value(); })
+		| transform([&splatting](const any* const memory) { return splatting.sizeByte(*memory); }), SizeType {}, plus {});
+	const auto output_size = fold_left(this->Tile_ | transform([](const Tile& tile) static noexcept {
+		return visit([](const auto& output) static noexcept -> SizeType { return output.sizeByte(); }, tile.Output);
+	}), SizeType {}, plus {});
+	return memory_size + output_size;
+}
+
+span<const Hybrid::Tile> Hybrid::operator()(
+	const Base& splatting, const Base::InvokeInfo& invoke_info, const RegionfieldView regionfield) {
+	DRR_ASSERT(glm::all(glm::greaterThan(this->TileSize, DimensionType(0U))));
+	DRR_ASSERT(this->DenseThreshold >= 0.0F);
+	const auto [offset, extent, boundary, sorted] = invoke_info;
+
+	const DimensionType tile_count = (extent + this->TileSize - 1U) / this->TileSize;
+	this->Tile_.resize(tile_count.x * tile_count.y);
+	for (auto tile_it = this->Tile_.begin();
+		const auto x : iota(DimensionType::value_type {}, tile_count.x)) {
+		for (const auto y : iota(DimensionType::value_type {}, tile_count.y)) {
+			auto& [tile_invoke_info, tile_output] = *tile_it++;
+			const DimensionType tile_offset = DimensionType(x, y) * this->TileSize;
+			tile_invoke_info = {
+				.Offset = offset + tile_offset,
+				.Extent = glm::min(this->TileSize, extent - tile_offset),
+				.Boundary = boundary,
+				.Sorted = sorted
+			};
+
+			if (this->isDense(splatting, tile_invoke_info, regionfield)) {
+				swapOutput<DenseTrait>(tile_output, splatting(DenseTrait {}, tile_invoke_info, regionfield, this->DenseMemory));
+			} else {
+				swapOutput<SparseTrait>(tile_output, splatting(SparseTrait {}, tile_invoke_info, regionfield, this->SparseMemory));
+			}
+		}
+	}
+	return this->Tile_;
+}
\ No newline at end of file
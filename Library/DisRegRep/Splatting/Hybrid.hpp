@@ -0,0 +1,98 @@
+#pragma once
+
+#include "Base.hpp"
+#include "Container.hpp"
+
+#include <DisRegRep/Container/RegionfieldView.hpp>
+
+#include <vector>
+
+#include <any>
+#include <span>
+#include <variant>
+
+namespace DisRegRep::Splatting {
+
+/**
+ * @brief Invoke a splatting tile by tile, choosing the container trait for every tile individually. A cheap presence pass counts the
+ * number of distinct regions covered by the convolution footprint of each tile; tiles with a high region diversity use dense kernel and
+ * dense output, otherwise sparse kernel and sparse output are used.
+ */
+class Hybrid {
+public:
+
+	using SizeType = Base::SizeType;
+	using DimensionType = Base::DimensionType;
+
+	using DenseTrait = decltype(Container::DenseKernelDenseOutputTrait);
+	using SparseTrait = decltype(Container::SparseKernelSparseOutputTrait);
+	using OutputType = std::variant<typename DenseTrait::MaskOutputType, typename SparseTrait::MaskOutputType>;
+
+	/**
+	 * @brief Splatting coefficients of a tile.
+	 */
+	struct Tile {
+
+		Base::InvokeInfo InvokeInfo_; /**< Area on the regionfield covered by this tile. */
+		OutputType Output; /**< Region mask of this tile, whose layout follows that of the splatting. */
+
+	};
+
+	DimensionType TileSize = DimensionType(64U); /**< Maximum extent of a tile. */
+	/**
+	 * @brief A tile uses dense containers if the number of distinct regions in its footprint is at least this fraction of the total
+	 * number of regions on the regionfield.
+	 */
+	float DenseThreshold = 0.25F;
+
+private:
+
+	//Scratch memory of the splatting for each container trait.
+	std::any DenseMemory, SparseMemory;
+
+	std::vector<Tile> Tile_;
+	std::vector<bool> Presence; /**< Indexed by region identifier. */
+
+	//Check if a tile should use dense containers.
+	[[nodiscard]] bool isDense(const Base&, const Base::InvokeInfo&, DisRegRep::Container::RegionfieldView);
+
+public:
+
+	constexpr Hybrid() = default;
+
+	Hybrid(const Hybrid&) = delete;
+
+	Hybrid(Hybrid&&) noexcept = default;
+
+	Hybrid& operator=(const Hybrid&) = delete;
+
+	Hybrid& operator=(Hybrid&&) noexcept = default;
+
+	~Hybrid() = default;
+
+	/**
+	 * @brief Query the total memory usage held by this executor, including the scratch memory and the output of every tile.
+	 *
+	 * @param splatting Splatting method that has been used by this executor for at least one computation.
+	 *
+	 * @return Total memory usage in bytes.
+	 *
+	 * @exception std::bad_any_cast If scratch memory was last used by a different splatting method than `splatting`.
+	 */
+	[[nodiscard]] SizeType sizeByte(const Base&) const;
+
+	/**
+	 * @brief Compute region feature splatting coefficients tile by tile.
+	 *
+	 * @param splatting Splatting method.
+	 * @param invoke_info @link Base::InvokeInfo.
+	 * @param regionfield Splatting coefficients are computed for this regionfield.
+	 *
+	 * @return Every tile covering `invoke_info`, in row-major order of tiles. Memory of the output is owned by this executor, and is
+	 * reused by the next invocation.
+	 */
+	std::span<const Tile> operator()(const Base&, const Base::InvokeInfo&, DisRegRep::Container::RegionfieldView);
+
+};
+
+}
\ No newline at end of file
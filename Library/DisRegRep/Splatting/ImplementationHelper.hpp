@@ -3,7 +3,7 @@
 #include "Base.hpp"
 #include "Container.hpp"
 
-#include <DisRegRep/Container/Regionfield.hpp>
+#include <DisRegRep/Container/RegionfieldView.hpp>
 
 #include <any>
 #include <tuple>
@@ -34,7 +34,28 @@
 #define DRR_SPLATTING_DEFINE_FUNCTOR_ALL(IMPL_NAME) \
 	DRR_SPLATTING_DEFINE_FUNCTOR(IMPL_NAME, Dense, Dense) \
 	DRR_SPLATTING_DEFINE_FUNCTOR(IMPL_NAME, Dense, Sparse) \
-	DRR_SPLATTING_DEFINE_FUNCTOR(IMPL_NAME, Sparse, Sparse)
+	DRR_SPLATTING_DEFINE_FUNCTOR(IMPL_NAME, Sparse, Sparse) \
+	DRR_SPLATTING_DEFINE_FUNCTOR(IMPL_NAME, Fixed4, Dense) \
+	DRR_SPLATTING_DEFINE_FUNCTOR(IMPL_NAME, Fixed8, Dense) \
+	DRR_SPLATTING_DEFINE_FUNCTOR(IMPL_NAME, Fixed16, Dense) \
+	DRR_SPLATTING_DEFINE_FUNCTOR(IMPL_NAME, Dense, Planar) \
+	DRR_SPLATTING_DEFINE_FUNCTOR(IMPL_NAME, Sparse, CompactSparse) \
+	DRR_SPLATTING_DEFINE_FUNCTOR(IMPL_NAME, Sparse, QuantisedSparse) \
+	DRR_SPLATTING_DEFINE_FUNCTOR(IMPL_NAME, Sparse, TopK4)
+//Do `DRR_SPLATTING_DEFINE_FUNCTOR_ALL` for a splatting implementation that is a class template.
+//`TEMPLATE_HEAD` is the template parameter declaration of the class template, and `IMPL_NAME` is the class template specialisation
+//	with these template parameters.
+#define DRR_SPLATTING_DEFINE_FUNCTOR_ALL_TEMPLATE(TEMPLATE_HEAD, IMPL_NAME) \
+	TEMPLATE_HEAD DRR_SPLATTING_DEFINE_FUNCTOR(IMPL_NAME, Dense, Dense) \
+	TEMPLATE_HEAD DRR_SPLATTING_DEFINE_FUNCTOR(IMPL_NAME, Dense, Sparse) \
+	TEMPLATE_HEAD DRR_SPLATTING_DEFINE_FUNCTOR(IMPL_NAME, Sparse, Sparse) \
+	TEMPLATE_HEAD DRR_SPLATTING_DEFINE_FUNCTOR(IMPL_NAME, Fixed4, Dense) \
+	TEMPLATE_HEAD DRR_SPLATTING_DEFINE_FUNCTOR(IMPL_NAME, Fixed8, Dense) \
+	TEMPLATE_HEAD DRR_SPLATTING_DEFINE_FUNCTOR(IMPL_NAME, Fixed16, Dense) \
+	TEMPLATE_HEAD DRR_SPLATTING_DEFINE_FUNCTOR(IMPL_NAME, Dense, Planar) \
+	TEMPLATE_HEAD DRR_SPLATTING_DEFINE_FUNCTOR(IMPL_NAME, Sparse, CompactSparse) \
+	TEMPLATE_HEAD DRR_SPLATTING_DEFINE_FUNCTOR(IMPL_NAME, Sparse, QuantisedSparse) \
+	TEMPLATE_HEAD DRR_SPLATTING_DEFINE_FUNCTOR(IMPL_NAME, Sparse, TopK4)
 
 //Define a structure that holds scratch memory of splatting implementation.
 #define DRR_SPLATTING_DEFINE_SCRATCH_MEMORY(MEM_NAME) \
@@ -54,7 +75,7 @@ namespace DisRegRep::Splatting::ImplementationHelper {
 template<template<Container::IsTrait> typename ScratchMemory>
 using ScratchMemoryCombination = decltype(std::apply(
 	[]<typename... Trait>(Trait...) -> std::default_initializable auto { return std::tuple<ScratchMemory<Trait>...> {}; },
-	Container::Combination));
+	Container::AllCombination));
 
 /**
  * Internal, type-erased scratch memory type, which is basically a variant of every @link ScratchMemoryCombination.
@@ -116,6 +137,25 @@ template<
 	return allocation;
 }
 
+/**
+ * @brief Inspect a scratch memory previously allocated by @link allocate.
+ *
+ * @tparam ScratchMemory Type of the implementation-defined scratch memory.
+ * @tparam F Type of visitor.
+ *
+ * @param memory Type-erased storage that holds the scratch memory.
+ * @param f Invoked with a constant reference to the scratch memory of whichever container trait it was allocated with.
+ *
+ * @return The return value of `f`.
+ *
+ * @exception std::bad_any_cast If `memory` does not hold a scratch memory of type `ScratchMemory`.
+ */
+template<template<Container::IsTrait> typename ScratchMemory, typename F>
+decltype(auto) visit(const std::any& memory, F&& f) {
+	using std::any_cast, std::shared_ptr;
+	return std::visit(std::forward<F>(f), std::as_const(*any_cast<const shared_ptr<ScratchMemoryInternal<ScratchMemory>>&>(memory)));
+}
+
 /**
  * @brief Get memory usage.
  * 
@@ -129,9 +169,7 @@ template<template<Container::IsTrait> typename ScratchMemory>
 requires(std::apply(
 	[]<typename... Mem>(const Mem&...) { return (SizedScratchmemory<Mem> && ...); }, ScratchMemoryCombination<ScratchMemory> {}))
 [[nodiscard]] Base::SizeType sizeByte(const std::any& memory) {
-	using std::any_cast, std::visit, std::shared_ptr;
-	return visit([](const auto& allocation) static noexcept { return allocation.sizeByte(); },
-		*any_cast<const shared_ptr<ScratchMemoryInternal<ScratchMemory>>&>(memory));
+	return visit<ScratchMemory>(memory, [](const auto& allocation) static noexcept { return allocation.sizeByte(); });
 }
 
 /**
@@ -188,7 +226,7 @@ public:
  */
 template<Container::IsTrait Trait>
 [[nodiscard]] Simple<Trait>& allocateSimple(
-	const Base::InvokeInfo& invoke_info, const DisRegRep::Container::Regionfield& regionfield, std::any& memory) {
+	const Base::InvokeInfo& invoke_info, const DisRegRep::Container::RegionfieldView regionfield, std::any& memory) {
 	return allocate<Simple, Trait>(memory, typename Simple<Trait>::ExtentType(invoke_info.Extent, regionfield.RegionCount));
 }
 
@@ -0,0 +1,13 @@
+#pragma once
+
+#include "../Base.hpp"
+
+namespace DisRegRep::Splatting::OccupancyConvolution::Approximate {
+
+/**
+ * @brief An approximate convolution derives the region occupancy from a cheaper representation of the regionfield than the elements
+ * covered by the kernel, while guaranteeing a bound on the error.
+ */
+class Base : public OccupancyConvolution::Base { };
+
+}
\ No newline at end of file
@@ -0,0 +1,196 @@
+#include <DisRegRep/Splatting/OccupancyConvolution/Approximate/MultiResolution.hpp>
+#include <DisRegRep/Splatting/ImplementationHelper.hpp>
+
+#include <DisRegRep/Container/RegionfieldView.hpp>
+#include <DisRegRep/Container/SplatKernel.hpp>
+
+#include <DisRegRep/Core/View/Arithmetic.hpp>
+#include <DisRegRep/Core/View/Matrix.hpp>
+#include <DisRegRep/Core/Exception.hpp>
+#include <DisRegRep/Core/Type.hpp>
+#include <DisRegRep/Core/UninitialisedAllocator.hpp>
+
+#include <glm/common.hpp>
+
+#include <span>
+#include <tuple>
+#include <vector>
+
+#include <algorithm>
+#include <functional>
+#include <ranges>
+
+#include <utility>
+
+using DisRegRep::Splatting::OccupancyConvolution::Approximate::MultiResolution,
+	DisRegRep::Container::RegionfieldView;
+namespace SplatKernel = DisRegRep::Container::SplatKernel;
+namespace Type = DisRegRep::Core::Type;
+
+using std::span, std::tuple, std::tie, std::apply, std::vector;
+using std::ranges::for_each, std::ranges::fill, std::ranges::fold_left,
+	std::plus,
+	std::views::iota, std::views::stride, std::views::zip_transform;
+
+namespace {
+
+//Diametre of the kernel on the grid of blocks, which is odd and covers no more than the original kernel.
+[[nodiscard]] constexpr MultiResolution::KernelSizeType blockDiametre(
+	const MultiResolution::KernelSizeType d, const MultiResolution::KernelSizeType f) noexcept {
+	const MultiResolution::KernelSizeType q = d / f;
+	return q - (q % 2U == 0U ? 1U : 0U);
+}
+
+DRR_SPLATTING_DEFINE_SCRATCH_MEMORY(ScratchMemory) {
+public:
+
+	DRR_SPLATTING_SCRATCH_MEMORY_CONTAINER_TRAIT;
+
+	using ExtentType = typename ContainerTrait::MaskOutputType::Dimension3Type;
+	template<typename T>
+	using ContainerType = vector<T, DisRegRep::Core::UninitialisedAllocator<T>>;
+
+	//Blocks are summed by dense importance regardless of the kernel in the container trait,
+	//	because every block is expected to cover many regions.
+	SplatKernel::Dense Kernel;
+	//Shape of (block row, block column, region), (block row, sample column, region) and (sample row, sample column, region).
+	ContainerType<Type::RegionImportance> Block, Column;
+	ContainerType<Type::RegionMask> Sample;
+	typename ContainerTrait::MaskOutputType Output;
+
+	//(width, height, region count), number of blocks, number of samples
+	void resize(const tuple<ExtentType, MultiResolution::DimensionType, MultiResolution::DimensionType> arg) {
+		const auto [extent, block_count, sample_count] = arg;
+		const auto region_count = extent.z;
+
+		this->Kernel.resize(region_count);
+		this->Block.resize(block_count.x * block_count.y * region_count);
+		this->Column.resize(block_count.x * sample_count.y * region_count);
+		this->Sample.resize(sample_count.x * sample_count.y * region_count);
+		this->Output.resize(extent);
+	}
+
+	[[nodiscard]] MultiResolution::SizeType sizeByte() const noexcept {
+		return apply([](const auto&... member) static noexcept { return (member.sizeByte() + ...); }, tie(this->Kernel, this->Output))
+			+ span(this->Block).size_bytes() + span(this->Column).size_bytes() + span(this->Sample).size_bytes();
+	}
+
+};
+
+}
+
+DRR_SPLATTING_DEFINE_DELEGATING_FUNCTOR(MultiResolution) {
+	this->validate(invoke_info, regionfield);
+	const auto [offset, extent, _1, _2] = invoke_info;
+
+	const KernelSizeType f = this->reductionFactor(),
+		block_d = blockDiametre(this->diametre(), f),
+		block_r = (block_d - 1U) / 2U;
+	//The first sample has its centre on the offset, and the last sample is on or after the last element of the extent.
+	const DimensionType sample_count = (extent - 1U + f - 1U) / f + 1U,
+		block_count = sample_count + block_d - 1U,
+		//In the coordinate of the addressed regionfield, which is shifted by radius.
+		block_origin = offset + this->Radius - (block_r * f + (f - 1U) / 2U),
+		//Blocks at the end are clipped by the addressable boundary.
+		block_end = glm::min(block_origin + block_count * f, this->addressableExtent(invoke_info, regionfield));
+	const auto region_count = regionfield.RegionCount;
+
+	auto& [kernel_memory, block_memory, column_memory, sample_memory, output_memory] =
+		ImplementationHelper::allocate<ScratchMemory, ContainerTrait>(memory, tuple(
+			typename ScratchMemory<ContainerTrait>::ExtentType(extent, region_count), block_count, sample_count));
+	const auto block = block_memory | Core::View::Matrix::NewAxisLeft(region_count);
+	const auto column = column_memory | Core::View::Matrix::NewAxisLeft(region_count);
+	const auto sample = sample_memory | Core::View::Matrix::NewAxisLeft(region_count);
+
+	//Reduce the regionfield by accumulating importance of every block.
+	fill(block_memory, Type::RegionImportance {});
+	regionfield.visitRange2d([&](auto rf_2d) {
+		const auto rf = this->addressRegionfield(invoke_info, regionfield, std::move(rf_2d));
+		for (const auto x : iota(block_origin.x, block_end.x)) [[likely]] {
+			const auto block_row = (x - block_origin.x) / f * block_count.y;
+			const auto rf_row = rf[x];
+			for (const auto y : iota(block_origin.y, block_end.y)) [[likely]] {
+				block_memory[(block_row + (y - block_origin.y) / f) * region_count + rf_row[y]]++;
+			}
+		}
+	});
+
+	//Slide a kernel over the blocks separably, in the same way as the full fast convolution.
+	const auto slide = [&kernel_memory, block_d](const auto length, const auto input, const auto store) {
+		kernel_memory.clear();
+		for_each(iota(KernelSizeType {}, block_d), [&](const auto i) { kernel_memory.increment(input(i)); });
+		store(0U);
+		for (const auto i : iota(KernelSizeType {}, length - 1U)) [[likely]] {
+			kernel_memory.decrement(input(i));
+			kernel_memory.increment(input(i + block_d));
+			store(i + 1U);
+		}
+	};
+	for (const auto bx : iota(KernelSizeType {}, block_count.x)) [[likely]] {
+		slide(sample_count.y,
+			[&block, row = bx * block_count.y](const auto by) { return block[row + by]; },
+			[&kernel_memory, &column, row = bx * sample_count.y](const auto sy) {
+				std::ranges::copy(kernel_memory.span(), column[row + sy].begin());
+			});
+	}
+	for (const auto sy : iota(KernelSizeType {}, sample_count.y)) [[likely]] {
+		slide(sample_count.x,
+			[&column, sy, stride = sample_count.y](const auto bx) { return column[bx * stride + sy]; },
+			[&kernel_memory, &sample, sy, stride = sample_count.y](const auto sx) {
+				//Blocks clipped by the regionfield boundary contain fewer elements, so normalise by the actual number of elements.
+				const auto norm_factor =
+					static_cast<Type::RegionMask>(fold_left(kernel_memory.span(), Type::RegionImportance {}, plus {}));
+				std::ranges::copy(kernel_memory.span() | Core::View::Arithmetic::Normalise(norm_factor),
+					sample[sx * stride + sy].begin());
+			});
+	}
+
+	//Bilinearly interpolate samples to every output element.
+	const auto interpolant = [f](const KernelSizeType i, const KernelSizeType count) noexcept {
+		const KernelSizeType first = i / f;
+		return tuple(first, std::ranges::min(first + 1U, count - 1U),
+			static_cast<Type::RegionMask>(i % f) / static_cast<Type::RegionMask>(f));
+	};
+	auto out = output_memory.range().begin();
+	for (const auto x : iota(KernelSizeType {}, extent.x)) [[likely]] {
+		const auto [x0, x1, tx] = interpolant(x, sample_count.x);
+		for (const auto y : iota(KernelSizeType {}, extent.y)) [[likely]] {
+			const auto [y0, y1, ty] = interpolant(y, sample_count.y);
+			*out++ = zip_transform(
+				[w00 = (1.0F - tx) * (1.0F - ty), w01 = (1.0F - tx) * ty, w10 = tx * (1.0F - ty), w11 = tx * ty](
+					const auto s00, const auto s01, const auto s10, const auto s11) constexpr noexcept {
+					return w00 * s00 + w01 * s01 + w10 * s10 + w11 * s11;
+				},
+				sample[x0 * sample_count.y + y0], sample[x0 * sample_count.y + y1],
+				sample[x1 * sample_count.y + y0], sample[x1 * sample_count.y + y1]
+			);
+		}
+	}
+	return output_memory;
+}
+
+void MultiResolution::validate(const InvokeInfo& invoke_info, const RegionfieldView regionfield) const {
+	this->Base::validate(invoke_info, regionfield);
+
+	DRR_ASSERT(this->Tolerance > 0.0F);
+}
+
+Type::RegionMask MultiResolution::errorBound(const KernelSizeType f) const noexcept {
+	const KernelSizeType d = this->diametre();
+	const auto d_real = static_cast<Type::RegionMask>(d),
+		scale = static_cast<Type::RegionMask>(blockDiametre(d, f) * f) / d_real;
+	return static_cast<Type::RegionMask>(f) / d_real + (1.0F - scale * scale);
+}
+
+MultiResolution::KernelSizeType MultiResolution::reductionFactor() const noexcept {
+	KernelSizeType f = 1U;
+	for (const auto candidate : iota(KernelSizeType { 1 }, this->diametre() + 1U) | stride(2U)) {
+		if (this->errorBound(candidate) <= this->Tolerance) {
+			f = candidate;
+		}
+	}
+	return f;
+}
+
+DRR_SPLATTING_DEFINE_SIZE_BYTE(MultiResolution, ScratchMemory)
+DRR_SPLATTING_DEFINE_FUNCTOR_ALL(MultiResolution)
\ No newline at end of file
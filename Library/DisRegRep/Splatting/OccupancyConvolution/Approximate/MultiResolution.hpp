@@ -0,0 +1,65 @@
+#pragma once
+
+#include "Base.hpp"
+
+#include <DisRegRep/Container/RegionfieldView.hpp>
+#include <DisRegRep/Core/Type.hpp>
+
+namespace DisRegRep::Splatting::OccupancyConvolution::Approximate {
+
+/**
+ * @brief Approximate a full occupancy convolution with a large kernel by splatting a reduced regionfield. The regionfield is divided
+ * into blocks whose size is the reduction factor along each axis, and every block holds the importance of each region within it, such
+ * that the reduction preserves importance. Region masks are computed on the grid of blocks with a scaled kernel, and bilinearly
+ * interpolated back to the original resolution. The reduction factor is chosen from @link Tolerance, and the cost of convolution is
+ * roughly reduced by its square.
+ */
+class MultiResolution final : public Base {
+public:
+
+	/**
+	 * @brief Maximum absolute error of region mask allowed. The reduction factor is chosen automatically such that the error bound
+	 * does not exceed this value.
+	 */
+	Core::Type::RegionMask Tolerance = 0.01F;
+
+private:
+
+	DRR_SPLATTING_DECLARE_DELEGATING_FUNCTOR_IMPL;
+
+protected:
+
+	void validate(const InvokeInfo&, DisRegRep::Container::RegionfieldView) const override;
+
+public:
+
+	/**
+	 * @brief Calculate the error bound of region mask for a reduction factor $f$. Moving a kernel of diametre $d$ by one element along
+	 * an axis changes any region mask by no more than $1/d$, and bilinear interpolation between samples $f$ apart moves the kernel by
+	 * $f/2$ along each axis on average, which contributes $f/d$. The kernel on the grid of blocks has a diametre $d'$, the greatest odd
+	 * multiple of $f$ no greater than $d$, and shrinking the kernel changes any region mask by no more than $1 - (d'/d)^2$.
+	 *
+	 * @param f Reduction factor, which must be a positive odd number no greater than the kernel diametre.
+	 *
+	 * @return The error bound, which is the sum of both terms.
+	 */
+	[[nodiscard]] Core::Type::RegionMask errorBound(KernelSizeType) const noexcept;
+
+	/**
+	 * @brief Calculate the reduction factor. The greatest odd $f$ whose @link errorBound meets @link Tolerance is picked, such that the
+	 * centre of a block coincides with an element. The error bound is not monotonic in $f$, because $d'$ depends on the remainder of
+	 * $d$ divided by $f$, so every candidate is checked.
+	 *
+	 * @return The reduction factor, which is always a positive odd number no greater than the kernel diametre.
+	 */
+	[[nodiscard]] KernelSizeType reductionFactor() const noexcept;
+
+	DRR_SPLATTING_SET_INFO("A0", false)
+
+	DRR_SPLATTING_DECLARE_SIZE_BYTE_IMPL;
+
+	DRR_SPLATTING_DECLARE_FUNCTOR_ALL_IMPL;
+
+};
+
+}
\ No newline at end of file
@@ -1,24 +1,32 @@
 #include <DisRegRep/Splatting/OccupancyConvolution/Base.hpp>
 #include <DisRegRep/Splatting/Base.hpp>
 
-#include <DisRegRep/Container/Regionfield.hpp>
+#include <DisRegRep/Container/RegionfieldView.hpp>
 
 #include <DisRegRep/Core/Exception.hpp>
 
 #include <glm/vector_relational.hpp>
 
 using DisRegRep::Splatting::OccupancyConvolution::Base,
-	DisRegRep::Container::Regionfield;
+	DisRegRep::Container::RegionfieldView;
+
+Base::DimensionType Base::addressableExtent(const InvokeInfo& invoke_info, const RegionfieldView regionfield) const noexcept {
+	//Without boundary mode nothing beyond the regionfield is addressable, and the leading radius only accounts for the shift.
+	const KernelSizeType halo = invoke_info.Boundary == BoundaryMode::None ? this->Radius : 2U * this->Radius;
+	return DimensionType(regionfield.extent()) + halo;
+}
 
 Base::DimensionType Base::minimumRegionfieldDimension(const InvokeInfo& invoke_info) const {
-	return this->Splatting::Base::minimumRegionfieldDimension(invoke_info) + this->Radius;
+	//Halo is resolved by boundary mode.
+	return this->Splatting::Base::minimumRegionfieldDimension(invoke_info)
+		+ (invoke_info.Boundary == BoundaryMode::None ? this->Radius : KernelSizeType {});
 }
 
 Base::DimensionType Base::minimumOffset() const {
 	return this->Splatting::Base::minimumOffset() + this->Radius;
 }
 
-Base::DimensionType Base::maximumExtent(const Regionfield& regionfield, const DimensionType offset) const {
+Base::DimensionType Base::maximumExtent(const RegionfieldView regionfield, const DimensionType offset) const {
 	const DimensionType base_max_extent = this->Splatting::Base::maximumExtent(regionfield, offset);
 	DRR_ASSERT(glm::all(glm::greaterThanEqual(base_max_extent, DimensionType(this->Radius))));
 	return base_max_extent - this->Radius;
@@ -2,12 +2,13 @@
 
 #include "../Base.hpp"
 
-#include <DisRegRep/Container/Regionfield.hpp>
+#include <DisRegRep/Container/RegionfieldView.hpp>
 #include <DisRegRep/Core/View/Functional.hpp>
 #include <DisRegRep/Core/View/Matrix.hpp>
 
 #include <tuple>
 
+#include <functional>
 #include <ranges>
 
 #include <utility>
@@ -37,40 +38,87 @@ protected:
 	static constexpr std::bool_constant<false> ExcludeOffsetEnumeration;
 
 	/**
-	 * @brief Create a range that iterates through every element in the regionfield. For each element, constructs a 2D convolution
-	 * kernel around the element.
+	 * @brief Get the extent of the range given by @link addressRegionfield.
+	 *
+	 * @param invoke_info @link InvokeInfo.
+	 * @param regionfield Regionfield to be addressed.
+	 *
+	 * @return Extent of the addressable regionfield.
+	 */
+	[[nodiscard]] DimensionType addressableExtent(const InvokeInfo&, DisRegRep::Container::RegionfieldView) const noexcept;
+
+	/**
+	 * @brief Address the regionfield in a coordinate system shifted by the radius, such that the first kernel of the splatting
+	 * starts from @link InvokeInfo::Offset rather than the offset minus radius. Elements outside the regionfield are resolved by
+	 * @link InvokeInfo::Boundary.
 	 *
-	 * @tparam EnumOffset Specify if the innermost range value should enumerate kernel offset like @link std::views::enumerate.
+	 * @tparam Rf2d Type of 2D range of the regionfield.
 	 *
 	 * @param invoke_info @link InvokeInfo.
-	 * @param regionfield Input whose region occupancies are convolved.
+	 * @param regionfield Regionfield to be addressed.
+	 * @param rf_2d The 2D range of `regionfield` given by @link DisRegRep::Container::RegionfieldView::visitRange2d.
 	 *
-	 * @return A range of 2D convolution kernel.
+	 * @return A 2D range of region identifier with extent of @link addressableExtent.
 	 */
-	template<bool EnumOffset>
-	[[nodiscard]] constexpr std::ranges::view auto convolve(
-		std::bool_constant<EnumOffset>,
+	template<std::ranges::random_access_range Rf2d>
+	[[nodiscard]] constexpr std::ranges::view auto addressRegionfield(
+		const InvokeInfo& invoke_info,
+		const DisRegRep::Container::RegionfieldView regionfield,
+		Rf2d&& rf_2d
+	) const noexcept {
+		using std::views::iota, std::views::transform;
+
+		using IndexType = DimensionType::value_type;
+		using SignedType = std::make_signed_t<IndexType>;
+		const DimensionType extent = this->addressableExtent(invoke_info, regionfield),
+			rf_extent = regionfield.extent();
+		return iota(IndexType {}, extent.x) | transform([
+			rf_2d = std::forward<Rf2d>(rf_2d),
+			boundary = invoke_info.Boundary,
+			r = static_cast<SignedType>(this->Radius),
+			rf_extent,
+			height = extent.y
+		](const auto x) constexpr noexcept {
+			//Each row is only resolved once, and then indexed directly by the column.
+			return iota(IndexType {}, height) | transform([
+				rf_row = rf_2d[Base::resolve(boundary, static_cast<SignedType>(x) - r, rf_extent.x)],
+				boundary,
+				r,
+				width = rf_extent.y
+			](const auto y) constexpr noexcept {
+				return rf_row[Base::resolve(boundary, static_cast<SignedType>(y) - r, width)];
+			});
+		});
+	}
+
+private:
+
+	//Create a range of 2D convolution kernels by slicing a 2D range of region identifier, whose origin is shifted by `shift` from
+	//	the regionfield coordinate.
+	template<bool EnumOffset, typename Rf2d>
+	[[nodiscard]] constexpr std::ranges::view auto makeKernelRange(
 		const InvokeInfo& invoke_info,
-		const DisRegRep::Container::Regionfield& regionfield
+		Rf2d&& rf_2d,
+		const DimensionType shift
 	) const noexcept {
 		using std::views::cartesian_product, std::views::iota, std::views::transform,
 			std::integer_sequence, std::make_integer_sequence;
 
 		using LengthType = DimensionType::length_type;
 		return [&invoke_info, r = this->Radius]<LengthType... I>(integer_sequence<LengthType, I...>) constexpr noexcept {
-			const auto [offset, extent] = invoke_info;
 			//It is much more clean to use std::views::take; keeping iota_view sized to allow better compiler optimisation.
-			return cartesian_product([&, r] constexpr noexcept {
-				const DimensionType::value_type start = offset[I] - r;
-				return iota(start, start + extent[I]);
+			return cartesian_product([&invoke_info, r] constexpr noexcept {
+				const DimensionType::value_type start = invoke_info.Offset[I] - r;
+				return iota(start, start + invoke_info.Extent[I]);
 			}()...);
 		}(make_integer_sequence<LengthType, DimensionType::length()> {})
 			| Core::View::Functional::MakeFromTuple<DimensionType>
 			| transform([
 				kernel_extent = DimensionType(this->diametre()),
-				rf_2d = regionfield.range2d()
+				shift,
+				rf_2d = std::forward<Rf2d>(rf_2d)
 			](const auto kernel_offset) constexpr noexcept {
-				if constexpr (auto sliced_rf = rf_2d | Core::View::Matrix::Slice2d(kernel_offset, kernel_extent);
+				if constexpr (auto sliced_rf = rf_2d | Core::View::Matrix::Slice2d(kernel_offset + shift, kernel_extent);
 					EnumOffset) {
 					return std::tuple(kernel_offset, std::move(sliced_rf));
 				} else {
@@ -79,13 +127,49 @@ protected:
 			});
 	}
 
+protected:
+
+	/**
+	 * @brief Create a range that iterates through every element in the regionfield. For each element, constructs a 2D convolution
+	 * kernel around the element.
+	 *
+	 * @tparam EnumOffset Specify if the innermost range value should enumerate kernel offset like @link std::views::enumerate. Kernel
+	 * offset wraps around the unsigned range if the kernel starts outside the regionfield with a @link BoundaryMode.
+	 * @tparam F Type of function.
+	 *
+	 * @param invoke_info @link InvokeInfo.
+	 * @param regionfield Input whose region occupancies are convolved.
+	 * @param f Invoked with a range of 2D convolution kernel. The regionfield is read through
+	 * @link DisRegRep::Container::RegionfieldView::visitRange2d, and is sliced directly if @link InvokeInfo::Boundary is
+	 * @link BoundaryMode::None, otherwise it is addressed by @link addressRegionfield; the range has a different type in each case.
+	 */
+	template<bool EnumOffset, typename F>
+	constexpr void convolve(
+		std::bool_constant<EnumOffset>,
+		const InvokeInfo& invoke_info,
+		const DisRegRep::Container::RegionfieldView regionfield,
+		F&& f
+	) const {
+		using std::invoke;
+
+		regionfield.visitRange2d([this, &invoke_info, regionfield, &f](auto rf_2d) {
+			if (invoke_info.Boundary == BoundaryMode::None) [[likely]] {
+				invoke(f, this->makeKernelRange<EnumOffset>(invoke_info, std::move(rf_2d), DimensionType {}));
+			} else {
+				//Kernel offset is in the regionfield coordinate, but the addressed regionfield is shifted by radius.
+				invoke(f, this->makeKernelRange<EnumOffset>(
+					invoke_info, this->addressRegionfield(invoke_info, regionfield, std::move(rf_2d)), DimensionType(this->Radius)));
+			}
+		});
+	}
+
 public:
 
 	[[nodiscard]] DimensionType minimumRegionfieldDimension(const InvokeInfo&) const override;
 
 	[[nodiscard]] DimensionType minimumOffset() const override;
 
-	[[nodiscard]] DimensionType maximumExtent(const DisRegRep::Container::Regionfield&, DimensionType) const override;
+	[[nodiscard]] DimensionType maximumExtent(DisRegRep::Container::RegionfieldView, DimensionType) const override;
 
 	/**
 	 * @brief Calculate the kernel diametre given a radius.
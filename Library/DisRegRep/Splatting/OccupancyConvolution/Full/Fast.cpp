@@ -19,16 +19,20 @@
 #include <concepts>
 #include <type_traits>
 
+#include <cstddef>
+
 using DisRegRep::Splatting::OccupancyConvolution::Full::Fast;
+namespace SplatKernel = DisRegRep::Container::SplatKernel;
 
-using std::tuple, std::tie, std::apply;
+using std::tuple, std::tie, std::apply,
+	std::integral_constant, std::integer_sequence, std::make_integer_sequence, std::index_sequence, std::make_index_sequence;
 using std::ranges::for_each,
 	std::bind_back, std::bit_or, std::invoke,
 	std::views::take, std::views::drop, std::views::zip, std::views::transform;
 using std::output_iterator,
 	std::ranges::forward_range, std::ranges::view,
-	std::ranges::range_difference_t, std::ranges::range_value_t, std::ranges::range_const_reference_t;
-using std::invocable, std::invoke_result_t, std::common_type_t;
+	std::ranges::range_value_t, std::ranges::range_const_reference_t;
+using std::invocable, std::invoke_result_t, std::common_type_t, std::is_same_v;
 
 namespace {
 
@@ -65,26 +69,71 @@ public:
 
 };
 
+//Kernels with radius up to this value have their diametre known at compile time.
+constexpr Fast::KernelSizeType MaximumSpecialisedRadius = 8U;
+//Kernel held on the stack by a specialised convolution, such that the histogram of a dense kernel can be kept in registers.
+using StackKernel = SplatKernel::Fixed<16U>;
+
+//Compute the initial kernel in a scanline.
+template<forward_range Scanline, SplatKernel::Is KernelMemory>
+void initialise(const Scanline& scanline, KernelMemory& kernel_memory, const std::ptrdiff_t d) {
+	for_each(scanline | take(d), [&kernel_memory](const auto element) noexcept { kernel_memory.increment(element); });
+}
+template<forward_range Scanline, SplatKernel::Is KernelMemory, std::ptrdiff_t D>
+void initialise(const Scanline& scanline, KernelMemory& kernel_memory, integral_constant<std::ptrdiff_t, D>) {
+	//Unroll the window such that there is no loop overhead.
+	[&scanline, &kernel_memory]<std::size_t... I>(index_sequence<I...>) {
+		auto it = std::ranges::begin(scanline);
+		((static_cast<void>(I), kernel_memory.increment(*it), ++it), ...);
+	}(make_index_sequence<D> {});
+}
+
+//Invoke `f` with the kernel diametre, which is an integral constant for small radii.
+template<typename F>
+void dispatchDiametre(const Fast::KernelSizeType r, F&& f) {
+	if (const bool specialised = [r, &f]<Fast::KernelSizeType... R>(integer_sequence<Fast::KernelSizeType, R...>) {
+			return ((r == R + 1U ? (invoke(f, integral_constant<std::ptrdiff_t, Fast::diametre(R + 1U)> {}), true) : false) || ...);
+		}(make_integer_sequence<Fast::KernelSizeType, MaximumSpecialisedRadius> {});
+		!specialised) {
+		invoke(std::forward<F>(f), static_cast<std::ptrdiff_t>(Fast::diametre(r)));
+	}
+}
+
+//Invoke `f` with a stack kernel if the diametre is specialised, the container trait uses a dense kernel and the stack kernel can
+//	hold every region, otherwise with the kernel from scratch memory.
+template<typename Diametre, SplatKernel::Is KernelMemory, typename F>
+void dispatchKernel(Diametre, KernelMemory& kernel_memory, const Fast::KernelSizeType region_count, F&& f) {
+	if constexpr (!is_same_v<Diametre, std::ptrdiff_t> && is_same_v<KernelMemory, SplatKernel::Dense>) {
+		if (region_count <= StackKernel::Capacity) {
+			StackKernel stack_kernel;
+			stack_kernel.resize(region_count);
+			invoke(std::forward<F>(f), stack_kernel);
+			return;
+		}
+	}
+	invoke(std::forward<F>(f), kernel_memory);
+}
+
 template<
 	forward_range ScanlineRange,
-	DisRegRep::Container::SplatKernel::Is KernelMemory,
+	SplatKernel::Is KernelMemory,
 	typename KernelMemoryProj,
+	typename Diametre,
 	forward_range Scanline = range_value_t<ScanlineRange>
 >
 requires view<Scanline>
 void conv1d(
 	ScanlineRange&& scanline_rg,
 	KernelMemory& kernel_memory,
-	output_iterator<invoke_result_t<KernelMemoryProj, const KernelMemory&>> auto out,
-	const range_difference_t<Scanline> d,
+	output_iterator<invoke_result_t<KernelMemoryProj, KernelMemory&>> auto out,
+	const Diametre d,
 	KernelMemoryProj kernel_memory_proj
 ) {
 	for (const auto scanline : std::forward<ScanlineRange>(scanline_rg)) [[likely]] {
 		kernel_memory.clear();
 
-		//Compute the initial kernel in this scanline.
-		for_each(scanline | take(d), [&kernel_memory](const auto element) noexcept { kernel_memory.increment(element); });
-		*out++ = invoke(kernel_memory_proj, std::as_const(kernel_memory));
+		initialise(scanline, kernel_memory, d);
+		*out++ = invoke(kernel_memory_proj, kernel_memory);
 
 		//Kernel sliding.
 		using std::ranges::transform;
@@ -104,7 +153,7 @@ void conv1d(
 				//Increment inserts at the back.
 				kernel_memory.decrement(dec_element);
 				kernel_memory.increment(inc_element);
-				return invoke(km_proj, std::as_const(kernel_memory));
+				return invoke(km_proj, kernel_memory);
 			}
 		).out;
 	}
@@ -114,7 +163,7 @@ void conv1d(
 
 DRR_SPLATTING_DEFINE_DELEGATING_FUNCTOR(Fast) {
 	this->validate(invoke_info, regionfield);
-	const auto [offset, extent] = invoke_info;
+	const auto [offset, extent, _, sorted] = invoke_info;
 
 	const KernelSizeType d = this->diametre(),
 		//Padding does not include the centre element (only the halo), so minus one from the diametre.
@@ -123,25 +172,40 @@ DRR_SPLATTING_DEFINE_DELEGATING_FUNCTOR(Fast) {
 	auto& [kernel_memory, vertical_memory, horizontal_memory] = ImplementationHelper::allocate<ScratchMemory, ContainerTrait>(
 		memory, tuple(typename ScratchMemory<ContainerTrait>::ExtentType(extent, regionfield.RegionCount), d_halo));
 
-	//Need to read the whole halo from regionfield.
-	//In vertical scanline, this overlaps with the 1D kernel.
-	//In horizontal scanline, this includes the padding.
-	conv1d(
-		regionfield.range2d() | Core::View::Matrix::Slice2d(offset - this->Radius, extent + d_halo),
-		kernel_memory,
-		vertical_memory.range().begin(),
-		d,
-		[](const auto& km) static constexpr noexcept { return km.span(); }
-	);
-	//Repeat the same process in the horizontal pass.
-	conv1d(
-		vertical_memory.rangeTransposed2d() | transform(bind_back(bit_or {}, Core::View::Functional::Dereference)),
-		kernel_memory,
-		horizontal_memory.range().begin(),
-		d,
-		[norm_factor = Fast::area(d)](
-			const auto& km) constexpr noexcept { return DisRegRep::Container::SplatKernel::toMask(km, norm_factor); }
-	);
+	dispatchDiametre(this->Radius, [&](const auto dispatched_d) {
+		dispatchKernel(dispatched_d, kernel_memory, regionfield.RegionCount, [&](auto& dispatched_kernel) {
+			//Need to read the whole halo from regionfield.
+			//In vertical scanline, this overlaps with the 1D kernel.
+			//In horizontal scanline, this includes the padding.
+			const auto vertical_pass = [&](auto&& scanline_rg) {
+				conv1d(
+					std::forward<decltype(scanline_rg)>(scanline_rg),
+					dispatched_kernel,
+					vertical_memory.range().begin(),
+					dispatched_d,
+					[](const auto& km) static constexpr noexcept { return km.span(); }
+				);
+			};
+			//Regionfield is sliced directly when no element outside it needs to be resolved.
+			regionfield.visitRange2d([&](auto rf_2d) {
+				if (invoke_info.Boundary == BoundaryMode::None) [[likely]] {
+					vertical_pass(std::move(rf_2d) | Core::View::Matrix::Slice2d(offset - this->Radius, extent + d_halo));
+				} else {
+					vertical_pass(this->addressRegionfield(invoke_info, regionfield, std::move(rf_2d))
+						| Core::View::Matrix::Slice2d(offset, extent + d_halo));
+				}
+			});
+			//Repeat the same process in the horizontal pass.
+			conv1d(
+				vertical_memory.rangeTransposed2d() | transform(bind_back(bit_or {}, Core::View::Functional::Dereference)),
+				dispatched_kernel,
+				horizontal_memory.range().begin(),
+				dispatched_d,
+				[norm_factor = Fast::area(d), sorted](
+					auto& km) constexpr noexcept { return SplatKernel::toMask(km, norm_factor, sorted); }
+			);
+		});
+	});
 	return horizontal_memory;
 }
 
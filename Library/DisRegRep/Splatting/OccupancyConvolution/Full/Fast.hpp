@@ -8,6 +8,9 @@ namespace DisRegRep::Splatting::OccupancyConvolution::Full {
  * @brief An improved version over the vanilla occupancy convolution, with two commonly used convolution optimisations integrated,
  * being separation and accumulation. Due to the use of separation and linear construction of the splatting coefficient matrix, the
  * output is transposed.
+ *
+ * Kernels of radius up to 8 are specialised with a diametre known at compile time, whose initial window is unrolled. If such kernel
+ * has a dense histogram of no more than 16 regions, the histogram is held on the stack instead of the scratch memory.
  */
 class Fast final : public Base {
 private:
@@ -0,0 +1,130 @@
+#include <DisRegRep/Splatting/OccupancyConvolution/Full/Fast3d.hpp>
+
+#include <DisRegRep/Container/Regionfield3d.hpp>
+
+#include <DisRegRep/Core/View/Arithmetic.hpp>
+#include <DisRegRep/Core/View/Matrix.hpp>
+#include <DisRegRep/Core/Exception.hpp>
+
+#include <glm/vector_relational.hpp>
+
+#include <span>
+
+#include <algorithm>
+#include <functional>
+#include <ranges>
+
+using DisRegRep::Splatting::OccupancyConvolution::Full::Fast3d,
+	DisRegRep::Container::Regionfield3d;
+
+using glm::greaterThan, glm::greaterThanEqual, glm::lessThanEqual;
+
+using std::span;
+using std::ranges::for_each, std::ranges::copy, std::ranges::fill,
+	std::bind_back, std::bit_or, std::plus, std::minus,
+	std::views::iota, std::views::transform;
+
+void Fast3d::validate(const InvokeInfo& invoke_info, const Regionfield3d& regionfield) const {
+	const auto [offset, extent] = invoke_info;
+
+	DRR_ASSERT(regionfield.RegionCount > 0U);
+	DRR_ASSERT(glm::all(greaterThan(extent, DimensionType(0U))));
+	DRR_ASSERT(glm::all(greaterThanEqual(offset, this->minimumOffset())));
+	DRR_ASSERT(glm::all(lessThanEqual(this->minimumRegionfieldDimension(invoke_info), regionfield.extent())));
+}
+
+void Fast3d::allocate(const InvokeInfo& invoke_info, const Regionfield3d& regionfield) {
+	const DimensionType extent = invoke_info.Extent;
+	const IndexType region_count = regionfield.RegionCount,
+		slab_size = extent.y * extent.z * region_count;
+
+	this->Kernel.resize(region_count);
+	this->Column.resize((extent.y + Base::diametre(this->Radius) - 1U) * extent.z * region_count);
+	this->Plane.resize(slab_size);
+	this->Slab.resize(slab_size);
+	this->Output.resize(MaskOutputType::Dimension3Type(extent.y, extent.z, region_count));
+}
+
+void Fast3d::convolvePlane(const InvokeInfo& invoke_info, const Regionfield3d& regionfield, const IndexType row) {
+	const auto [offset, extent] = invoke_info;
+	const KernelSizeType d = Base::diametre(this->Radius);
+	const DimensionType origin = offset - this->Radius;
+	const auto region_count = this->Kernel.size();
+
+	auto& kernel = this->Kernel;
+	const auto rf = regionfield.mdspan();
+	const auto column_memory = this->Column | Core::View::Matrix::NewAxisLeft(region_count);
+	const auto plane_memory = this->Plane | Core::View::Matrix::NewAxisLeft(region_count);
+	const auto store = [&kernel](auto&& importance) { copy(kernel.span(), std::ranges::begin(importance)); };
+
+	//Layer pass, which also covers the halo of the column pass.
+	for (const auto column : iota(IndexType {}, extent.y + d - 1U)) [[likely]] {
+		const auto region_id = [&rf, row, column = origin.y + column, first = origin.z](const IndexType layer) {
+			return rf[row, column, first + layer];
+		};
+		kernel.clear();
+		for_each(iota(IndexType {}, d), [&kernel, &region_id](const auto layer) { kernel.increment(region_id(layer)); });
+
+		const auto column_offset = column * extent.z;
+		store(column_memory[column_offset]);
+		for (const auto layer : iota(IndexType {}, extent.z - 1U)) [[likely]] {
+			kernel.decrement(region_id(layer));
+			kernel.increment(region_id(layer + d));
+			store(column_memory[column_offset + layer + 1U]);
+		}
+	}
+	//Column pass, which reads the result of the layer pass.
+	for (const auto layer : iota(IndexType {}, extent.z)) [[likely]] {
+		const auto importance = [&column_memory, layer, stride = extent.z](const IndexType column) {
+			return column_memory[column * stride + layer];
+		};
+		kernel.clear();
+		for_each(iota(IndexType {}, d), [&kernel, &importance](const auto column) { kernel.increment(importance(column)); });
+
+		store(plane_memory[layer]);
+		for (const auto column : iota(IndexType {}, extent.y - 1U)) [[likely]] {
+			kernel.decrement(importance(column));
+			kernel.increment(importance(column + d));
+			store(plane_memory[(column + 1U) * extent.z + layer]);
+		}
+	}
+}
+
+const Fast3d::MaskOutputType& Fast3d::convolveSlab(
+	const InvokeInfo& invoke_info, const Regionfield3d& regionfield, const IndexType row) {
+	const KernelSizeType d = Base::diametre(this->Radius);
+	//The first row of the regionfield covered by the kernel of this slab.
+	const IndexType first = invoke_info.Offset.x - this->Radius + row;
+	const auto accumulate = [this, &invoke_info, &regionfield](const IndexType rf_row, const auto op) {
+		this->convolvePlane(invoke_info, regionfield, rf_row);
+		std::ranges::transform(this->Slab, this->Plane, this->Slab.begin(), op);
+	};
+
+	if (row == 0U) {
+		fill(this->Slab, Core::Type::RegionImportance {});
+		for_each(iota(first, first + d), bind_back(accumulate, plus {}));
+	} else [[likely]] {
+		//Instead of buffering every plane in the kernel, the plane leaving the kernel is recomputed,
+		//	such that scratch memory does not grow with the radius.
+		accumulate(first - 1U, minus {});
+		accumulate(first + d - 1U, plus {});
+	}
+
+	copy(this->Slab | Core::View::Matrix::NewAxisLeft(this->Kernel.size())
+			| transform(bind_back(bit_or {}, Core::View::Arithmetic::Normalise(static_cast<Core::Type::RegionMask>(d * d * d)))),
+		this->Output.range().begin());
+	return this->Output;
+}
+
+Fast3d::DimensionType Fast3d::minimumRegionfieldDimension(const InvokeInfo& invoke_info) const noexcept {
+	return invoke_info.Offset + invoke_info.Extent + this->Radius;
+}
+
+Fast3d::DimensionType Fast3d::minimumOffset() const noexcept {
+	return DimensionType(this->Radius);
+}
+
+Fast3d::SizeType Fast3d::sizeByte() const noexcept {
+	return this->Kernel.sizeByte() + span(this->Column).size_bytes() + span(this->Plane).size_bytes() + span(this->Slab).size_bytes()
+		+ this->Output.sizeByte();
+}
\ No newline at end of file
@@ -0,0 +1,128 @@
+#pragma once
+
+#include "../Base.hpp"
+
+#include <DisRegRep/Container/Regionfield3d.hpp>
+#include <DisRegRep/Container/SplatKernel.hpp>
+#include <DisRegRep/Container/SplattingCoefficient.hpp>
+
+#include <DisRegRep/Core/Type.hpp>
+#include <DisRegRep/Core/UninitialisedAllocator.hpp>
+
+#include <vector>
+
+#include <functional>
+#include <ranges>
+
+#include <concepts>
+
+namespace DisRegRep::Splatting::OccupancyConvolution::Full {
+
+/**
+ * @brief A volumetric analogue of @link Fast, which computes region occupancy within a 3D convolution kernel on a
+ * @link Container::Regionfield3d. The convolution is separated into three sliding passes, one along each axis, such that the cost per
+ * element is independent of the radius. The output is produced one slab at a time, which is a 2D splatting coefficient matrix of a
+ * row of the volume, so scratch memory is proportional to the size of a slab rather than that of the volume.
+ *
+ * @note Only dense containers are supported.
+ */
+class Fast3d {
+public:
+
+	using KernelSizeType = Base::KernelSizeType;
+	using SizeType = Base::SizeType;
+	using IndexType = DisRegRep::Container::Regionfield3d::IndexType;
+	using DimensionType = DisRegRep::Container::Regionfield3d::DimensionType;
+	using MaskOutputType = DisRegRep::Container::SplattingCoefficient::DenseMask;
+
+	/**
+	 * @brief @link Splatting::Base::InvokeInfo in 3D.
+	 */
+	struct InvokeInfo {
+
+		DimensionType Offset, /**< Coordinate of the first point on the regionfield included for splatting. */
+			Extent; /**< Extent covering the volume on the regionfield where splatting are performed. */
+
+	};
+
+	KernelSizeType Radius {}; /**< Radius of the convolution kernel. */
+
+private:
+
+	using ImportanceContainerType = std::vector<Core::Type::RegionImportance, Core::UninitialisedAllocator<Core::Type::RegionImportance>>;
+
+	DisRegRep::Container::SplatKernel::Dense Kernel;
+	//Shape of (column + halo, layer, region), (column, layer, region) and (column, layer, region).
+	ImportanceContainerType Column, Plane, Slab;
+	MaskOutputType Output;
+
+	void validate(const InvokeInfo&, const DisRegRep::Container::Regionfield3d&) const;
+
+	void allocate(const InvokeInfo&, const DisRegRep::Container::Regionfield3d&);
+
+	//Convolve a row of the regionfield along layer and column axes, and store the result to the plane memory.
+	void convolvePlane(const InvokeInfo&, const DisRegRep::Container::Regionfield3d&, IndexType);
+
+	//Slide the kernel along the row axis to the given row of the output, and compute the region mask of this slab.
+	[[nodiscard]] const MaskOutputType& convolveSlab(const InvokeInfo&, const DisRegRep::Container::Regionfield3d&, IndexType);
+
+public:
+
+	constexpr Fast3d() = default;
+
+	Fast3d(const Fast3d&) = delete;
+
+	Fast3d(Fast3d&&) = delete;
+
+	Fast3d& operator=(const Fast3d&) = delete;
+
+	Fast3d& operator=(Fast3d&&) = delete;
+
+	constexpr ~Fast3d() = default;
+
+	/**
+	 * @brief @link Splatting::Base::minimumRegionfieldDimension.
+	 *
+	 * @param invoke_info @link InvokeInfo.
+	 *
+	 * @return Minimum regionfield dimension.
+	 */
+	[[nodiscard]] DimensionType minimumRegionfieldDimension(const InvokeInfo&) const noexcept;
+
+	/**
+	 * @brief @link Splatting::Base::minimumOffset.
+	 *
+	 * @return Minimum offset for @link InvokeInfo::Offset.
+	 */
+	[[nodiscard]] DimensionType minimumOffset() const noexcept;
+
+	/**
+	 * @brief Query the usage of scratch memory.
+	 *
+	 * @return Memory usage in bytes.
+	 */
+	[[nodiscard]] SizeType sizeByte() const noexcept;
+
+	/**
+	 * @brief Compute region feature splatting coefficients on a volumetric regionfield.
+	 *
+	 * @tparam S Type of output sink.
+	 *
+	 * @param invoke_info @link InvokeInfo.
+	 * @param regionfield Splatting coefficients are computed for this regionfield.
+	 * @param sink Invoked in order with the index of each row of `invoke_info`, and the region mask of this row, whose shape is
+	 * (column, layer, region). The region mask is only valid during the invocation, because its memory is reused by the next row.
+	 */
+	template<typename S>
+	requires std::invocable<S&, IndexType, const MaskOutputType&>
+	void operator()(const InvokeInfo& invoke_info, const DisRegRep::Container::Regionfield3d& regionfield, S& sink) {
+		this->validate(invoke_info, regionfield);
+		this->allocate(invoke_info, regionfield);
+		for (const auto row : std::views::iota(IndexType {}, invoke_info.Extent.x)) [[likely]] {
+			std::invoke(sink, row, this->convolveSlab(invoke_info, regionfield, row));
+		}
+	}
+
+};
+
+}
\ No newline at end of file
@@ -18,13 +18,15 @@ DRR_SPLATTING_DEFINE_DELEGATING_FUNCTOR(Vanilla) {
 	auto& [kernel_memory, output_memory] =
 		ImplementationHelper::PredefinedScratchMemory::allocateSimple<ContainerTrait>(invoke_info, regionfield, memory);
 
-	transform(this->convolve(Vanilla::ExcludeOffsetEnumeration, invoke_info, regionfield), output_memory.range().begin(),
-		[&kernel_memory, norm_factor = this->area()](auto kernel) noexcept {
-			kernel_memory.clear();
-			for_each(std::move(kernel) | std::views::join,
-				[&kernel_memory](const auto region_id) noexcept { kernel_memory.increment(region_id); });
-			return DisRegRep::Container::SplatKernel::toMask(kernel_memory, norm_factor);
-		});
+	this->convolve(Vanilla::ExcludeOffsetEnumeration, invoke_info, regionfield, [&](auto kernel_range) {
+		transform(std::move(kernel_range), output_memory.range().begin(),
+			[&kernel_memory, norm_factor = this->area(), sorted = invoke_info.Sorted](auto kernel) noexcept {
+				kernel_memory.clear();
+				for_each(std::move(kernel) | std::views::join,
+					[&kernel_memory](const auto region_id) noexcept { kernel_memory.increment(region_id); });
+				return DisRegRep::Container::SplatKernel::toMask(kernel_memory, norm_factor, sorted);
+			});
+	});
 	return output_memory;
 }
 
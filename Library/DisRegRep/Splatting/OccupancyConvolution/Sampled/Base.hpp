@@ -2,11 +2,28 @@
 
 #include "../Base.hpp"
 
+#include <any>
+
 namespace DisRegRep::Splatting::OccupancyConvolution::Sampled {
 
 /**
  * @brief A sampled convolution only takes a subset of elements from the kernel to derive the region occupancy.
  */
-class Base : public OccupancyConvolution::Base { };
+class Base : public OccupancyConvolution::Base {
+public:
+
+	/**
+	 * @brief Query the average number of samples taken from every convolution kernel.
+	 *
+	 * @param memory Scratch memory that has been used by the current splatting method for at least one computation. Only used by
+	 * splatting whose number of samples varies between kernels, and the result is from its most recent computation.
+	 *
+	 * @return Average number of samples per kernel.
+	 *
+	 * @exception std::bad_any_cast If `memory` is needed but is not a valid scratch memory for this splatting.
+	 */
+	[[nodiscard]] virtual double averageSample(const std::any&) const = 0;
+
+};
 
 }
\ No newline at end of file
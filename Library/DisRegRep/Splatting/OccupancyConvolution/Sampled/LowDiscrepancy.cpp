@@ -0,0 +1,105 @@
+#include <DisRegRep/Splatting/OccupancyConvolution/Sampled/LowDiscrepancy.hpp>
+#include <DisRegRep/Splatting/OccupancyConvolution/Sampled/Base.hpp>
+#include <DisRegRep/Splatting/ImplementationHelper.hpp>
+
+#include <DisRegRep/Container/RegionfieldView.hpp>
+#include <DisRegRep/Container/SplatKernel.hpp>
+
+#include <DisRegRep/Core/Exception.hpp>
+#include <DisRegRep/Core/Random.hpp>
+
+#include <glm/fwd.hpp>
+#include <glm/common.hpp>
+#include <glm/vec2.hpp>
+
+#include <any>
+
+#include <algorithm>
+#include <ranges>
+
+#include <random>
+#include <utility>
+
+#include <cstdint>
+
+using DisRegRep::Splatting::OccupancyConvolution::Sampled::BasicLowDiscrepancy,
+	DisRegRep::Splatting::ImplementationHelper::PredefinedScratchMemory::Simple,
+	DisRegRep::Container::RegionfieldView;
+namespace Random = DisRegRep::Core::Random;
+
+using std::ranges::transform, std::ranges::for_each,
+	std::views::repeat;
+using std::uniform_real_distribution,
+	std::integer_sequence, std::make_integer_sequence;
+
+namespace {
+
+using PointType = glm::f64vec2;
+using LengthType = PointType::length_type;
+
+//Generator of R2 sequence, which is the reciprocal of powers of the plastic number.
+constexpr PointType R2Generator(0.75487766624669276005, 0.56984029099805326591);
+
+}
+
+template<Random::IsEnginePolicy E>
+DRR_SPLATTING_DEFINE_DELEGATING_FUNCTOR(BasicLowDiscrepancy<E>) {
+	this->validate(invoke_info, regionfield);
+	auto& [kernel_memory, output_memory] =
+		ImplementationHelper::PredefinedScratchMemory::allocateSimple<ContainerTrait>(invoke_info, regionfield, memory);
+
+	const KernelSizeType d = this->diametre();
+	this->convolve(BasicLowDiscrepancy::IncludeOffsetEnumeration, invoke_info, regionfield, [&](auto kernel_range) {
+		transform(std::move(kernel_range), output_memory.range().begin(),
+			[
+				&kernel_memory,
+				key = EnginePolicy::makeKey(BasicLowDiscrepancy::generateSecret(this->Seed)),
+				d_max = DimensionType(d - 1U),
+				d_real = static_cast<PointType::value_type>(d),
+				sample_repetition = repeat(std::uint_least8_t {}, this->Sample),
+				norm_factor = this->Sample,
+				sorted = invoke_info.Sorted
+			](auto offset_kernel) {
+				const auto [offset, kernel] = std::move(offset_kernel);
+
+				//Cranley-Patterson rotation is uniformly distributed in the unit square.
+				PointType point = [rng = EnginePolicy::makeEngine(key, offset)]<LengthType... I>(integer_sequence<LengthType, I...>) mutable {
+					auto dist = uniform_real_distribution<PointType::value_type>();
+					return PointType(((void)I, dist(rng))...);
+				}(make_integer_sequence<LengthType, PointType::length()> {});
+
+				kernel_memory.clear();
+				for_each(sample_repetition, [&](auto) {
+					//Additive recurrence of R2 sequence modulo one, which is equivalent to rotating every point of the sequence.
+					//Error accumulated by the recurrence is negligible for a sensible number of samples in double precision.
+					point = glm::fract(point + R2Generator);
+					//Need to use min to avoid out-of-bound access due to floating point inaccuracy.
+					const DimensionType sample = glm::min(DimensionType(point * d_real), d_max);
+					kernel_memory.increment(kernel[sample.x][sample.y]);
+				});
+				return DisRegRep::Container::SplatKernel::toMask(kernel_memory, norm_factor, sorted);
+			});
+	});
+	return output_memory;
+}
+
+template<Random::IsEnginePolicy E>
+double BasicLowDiscrepancy<E>::averageSample(const std::any&) const {
+	return this->Sample;
+}
+
+template<Random::IsEnginePolicy E>
+void BasicLowDiscrepancy<E>::validate(const InvokeInfo& invoke_info, const RegionfieldView regionfield) const {
+	this->Base::validate(invoke_info, regionfield);
+
+	DRR_ASSERT(this->Sample > 0U);
+}
+
+template<Random::IsEnginePolicy E>
+DRR_SPLATTING_DEFINE_SIZE_BYTE(BasicLowDiscrepancy<E>, Simple)
+DRR_SPLATTING_DEFINE_FUNCTOR_ALL_TEMPLATE(template<Random::IsEnginePolicy E>, BasicLowDiscrepancy<E>)
+
+#define INSTANTIATE(ENGINE) template class DisRegRep::Splatting::OccupancyConvolution::Sampled::BasicLowDiscrepancy<Random::ENGINE>
+INSTANTIATE(XXH3);
+INSTANTIATE(SplitMix);
+INSTANTIATE(Squares);
\ No newline at end of file
@@ -0,0 +1,56 @@
+#pragma once
+
+#include "Base.hpp"
+
+#include <DisRegRep/Container/RegionfieldView.hpp>
+#include <DisRegRep/Core/Random.hpp>
+
+#include <any>
+#include <string_view>
+
+namespace DisRegRep::Splatting::OccupancyConvolution::Sampled {
+
+/**
+ * @brief Sample elements from the convolution kernel using a quasi-random sampling scheme. Samples follow the R2 low-discrepancy
+ * sequence, which covers the kernel more evenly than independent random samples, such that the error of region occupancy decreases
+ * at a rate close to the inverse of sample count rather than its square root. Every kernel applies a random Cranley-Patterson rotation,
+ * i.e. a toroidal shift, to the sequence, to decorrelate errors between neighbouring kernels while preserving the low discrepancy.
+ *
+ * @tparam E Policy of random engine used for generating rotations.
+ */
+template<Core::Random::IsEnginePolicy E>
+class BasicLowDiscrepancy final : public Base {
+public:
+
+	using EnginePolicy = E;
+
+	KernelSizeType Sample = 1U; /**< Number of samples to be taken from the convolution kernel. */
+	SeedType Seed {}; /**< Seed the rotation of the low-discrepancy sequence. */
+
+private:
+
+	static constexpr auto Name = Core::Random::appendSuffix<EnginePolicy>("S3");
+
+	DRR_SPLATTING_DECLARE_DELEGATING_FUNCTOR_IMPL;
+
+	void validate(const InvokeInfo&, DisRegRep::Container::RegionfieldView) const override;
+
+public:
+
+	DRR_SPLATTING_SET_INFO(std::string_view(Name.data(), Name.size()), false)
+
+	DRR_SPLATTING_DECLARE_SIZE_BYTE_IMPL;
+
+	[[nodiscard]] double averageSample(const std::any&) const override;
+
+	DRR_SPLATTING_DECLARE_FUNCTOR_ALL_IMPL;
+
+};
+
+extern template class BasicLowDiscrepancy<Core::Random::XXH3>;
+extern template class BasicLowDiscrepancy<Core::Random::SplitMix>;
+extern template class BasicLowDiscrepancy<Core::Random::Squares>;
+
+using LowDiscrepancy = BasicLowDiscrepancy<Core::Random::XXH3>;
+
+}
\ No newline at end of file
@@ -0,0 +1,123 @@
+#include <DisRegRep/Splatting/OccupancyConvolution/Sampled/SlidingSystematic.hpp>
+#include <DisRegRep/Splatting/ImplementationHelper.hpp>
+
+#include <DisRegRep/Container/SplatKernel.hpp>
+
+#include <span>
+#include <tuple>
+
+#include <algorithm>
+#include <functional>
+#include <ranges>
+
+#include <memory>
+
+#include <utility>
+
+using DisRegRep::Splatting::OccupancyConvolution::Sampled::SlidingSystematic;
+
+using std::span, std::tuple;
+using std::ranges::for_each, std::ranges::fold_left,
+	std::bind_back, std::mem_fn, std::invoke, std::plus,
+	std::views::iota, std::views::transform;
+using std::unique_ptr, std::make_unique;
+
+namespace {
+
+DRR_SPLATTING_DEFINE_SCRATCH_MEMORY(ScratchMemory) {
+public:
+
+	DRR_SPLATTING_SCRATCH_MEMORY_CONTAINER_TRAIT;
+
+	using KernelType = typename ContainerTrait::KernelType;
+	using ExtentType = typename ContainerTrait::MaskOutputType::Dimension3Type;
+
+private:
+
+	//Kernel is not movable, so cannot be put into a vector.
+	unique_ptr<KernelType[]> KernelAllocation;
+	SlidingSystematic::KernelSizeType KernelCapacity {};
+
+public:
+
+	span<KernelType> Kernel; /**< One kernel per lattice phase. */
+	typename ContainerTrait::MaskOutputType Output;
+
+	//(width, height, region count), number of lattice phase
+	void resize(const tuple<ExtentType, SlidingSystematic::KernelSizeType> arg) {
+		const auto [extent, phase_count] = arg;
+
+		if (this->KernelCapacity < phase_count) {
+			this->KernelAllocation = make_unique<KernelType[]>(phase_count);
+			this->KernelCapacity = phase_count;
+		}
+		this->Kernel = span(this->KernelAllocation.get(), phase_count);
+		for_each(this->Kernel, bind_back(mem_fn(&KernelType::resize), extent.z));
+		this->Output.resize(extent);
+	}
+
+	[[nodiscard]] SlidingSystematic::SizeType sizeByte() const noexcept {
+		return fold_left(span(this->KernelAllocation.get(), this->KernelCapacity) | transform(mem_fn(&KernelType::sizeByte)),
+			this->Output.sizeByte(), plus {});
+	}
+
+};
+
+}
+
+DRR_SPLATTING_DEFINE_DELEGATING_FUNCTOR(SlidingSystematic) {
+	this->validate(invoke_info, regionfield);
+	const auto [offset, extent, _, sorted] = invoke_info;
+
+	const KernelSizeType d = this->diametre();
+	const DimensionType remained_size = d - this->FirstSample,
+		sample_size = (remained_size + this->Interval - 1U) / this->Interval,
+		//Coordinate of the first sample of the first kernel, in the addressed regionfield shifted by radius.
+		origin = offset + this->FirstSample;
+	//Kernels are reinitialised when there are not enough output elements to slide them.
+	const KernelSizeType phase_count = std::ranges::min(this->Interval.y, extent.y);
+	//Cannot use structured binding because the scratch memory has private members.
+	auto& scratch_memory = ImplementationHelper::allocate<ScratchMemory, ContainerTrait>(
+		memory, tuple(typename ScratchMemory<ContainerTrait>::ExtentType(extent, regionfield.RegionCount), phase_count));
+	const span kernel_memory = scratch_memory.Kernel;
+	auto& output_memory = scratch_memory.Output;
+
+	regionfield.visitRange2d([&](auto rf_2d) {
+		const auto rf = this->addressRegionfield(invoke_info, regionfield, std::move(rf_2d));
+		const auto lattice_row = iota(KernelSizeType {}, sample_size.x)
+			| transform([interval = this->Interval.x](const auto i) constexpr noexcept { return i * interval; });
+		//Modify a kernel with every sample on a lattice column.
+		const auto modify_column = [&rf, &lattice_row](auto& kernel, const auto row, const auto column, const auto modifier) {
+			for_each(lattice_row, [&](const auto i) { invoke(modifier, kernel, rf[row + i][column]); });
+		};
+		static constexpr auto increment = [](auto& kernel, const auto region_id) static { kernel.increment(region_id); };
+		static constexpr auto decrement = [](auto& kernel, const auto region_id) static { kernel.decrement(region_id); };
+
+		const auto norm_factor = static_cast<typename ContainerTrait::MaskOutputType::ValueType>(sample_size.x * sample_size.y);
+		auto out = output_memory.range().begin();
+		//Output must be written in order, so instead of iterating through each phase one after the other,
+		//	all phases are kept alive and visited in turn.
+		for (const auto x : iota(KernelSizeType {}, extent.x)) [[likely]] {
+			const auto row = origin.x + x;
+			for (const auto y : iota(KernelSizeType {}, extent.y)) [[likely]] {
+				auto& kernel = kernel_memory[y % phase_count];
+				if (const auto column = origin.y + y;
+					y < phase_count) {
+					kernel.clear();
+					for_each(iota(KernelSizeType {}, sample_size.y), [&, column, interval = this->Interval.y](const auto j) {
+						modify_column(kernel, row, column + j * interval, increment);
+					});
+				} else [[likely]] {
+					//Same as the full fast convolution, decrement goes before increment.
+					modify_column(kernel, row, column - this->Interval.y, decrement);
+					modify_column(kernel, row, column + (sample_size.y - 1U) * this->Interval.y, increment);
+				}
+				*out++ = DisRegRep::Container::SplatKernel::toMask(kernel, norm_factor, sorted);
+			}
+		}
+	});
+	return output_memory;
+}
+
+DRR_SPLATTING_DEFINE_SIZE_BYTE(SlidingSystematic, ScratchMemory)
+DRR_SPLATTING_DEFINE_FUNCTOR_ALL(SlidingSystematic)
\ No newline at end of file
@@ -0,0 +1,28 @@
+#pragma once
+
+#include "Systematic.hpp"
+
+namespace DisRegRep::Splatting::OccupancyConvolution::Sampled {
+
+/**
+ * @brief An optimised @link Systematic sampling that produces identical output. Kernels whose offsets differ by a multiple of
+ * @link Interval share all but one column of their sample lattice, so output elements are grouped by lattice phase, and the sampled
+ * kernel of each phase is slid by decrementing the leaving column and incrementing the entering column. This reduces cost of each
+ * output element from the number of samples to twice the number of samples along one axis.
+ */
+class SlidingSystematic final : public Systematic {
+private:
+
+	DRR_SPLATTING_DECLARE_DELEGATING_FUNCTOR_IMPL;
+
+public:
+
+	DRR_SPLATTING_SET_INFO("S0+", false)
+
+	DRR_SPLATTING_DECLARE_SIZE_BYTE_IMPL;
+
+	DRR_SPLATTING_DECLARE_FUNCTOR_ALL_IMPL;
+
+};
+
+}
\ No newline at end of file
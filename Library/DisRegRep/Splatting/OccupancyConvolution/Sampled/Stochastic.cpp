@@ -2,11 +2,15 @@
 #include <DisRegRep/Splatting/OccupancyConvolution/Sampled/Base.hpp>
 #include <DisRegRep/Splatting/ImplementationHelper.hpp>
 
-#include <DisRegRep/Container/Regionfield.hpp>
+#include <DisRegRep/Container/RegionfieldView.hpp>
+#include <DisRegRep/Container/SparseMatrixElement.hpp>
 #include <DisRegRep/Container/SplatKernel.hpp>
 
 #include <DisRegRep/Core/Exception.hpp>
-#include <DisRegRep/Core/XXHash.hpp>
+#include <DisRegRep/Core/Random.hpp>
+
+#include <any>
+#include <tuple>
 
 #include <algorithm>
 #include <ranges>
@@ -14,59 +18,146 @@
 #include <random>
 #include <utility>
 
+#include <type_traits>
+
+#include <cmath>
 #include <cstdint>
 
-using DisRegRep::Splatting::OccupancyConvolution::Sampled::Stochastic,
-	DisRegRep::Splatting::ImplementationHelper::PredefinedScratchMemory::Simple,
-	DisRegRep::Container::Regionfield;
+using DisRegRep::Splatting::OccupancyConvolution::Sampled::BasicStochastic, DisRegRep::Splatting::OccupancyConvolution::Sampled::Stochastic,
+	DisRegRep::Container::RegionfieldView;
+namespace Random = DisRegRep::Core::Random;
 
-using std::ranges::transform, std::ranges::for_each,
+using std::tuple, std::tie, std::apply;
+using std::ranges::transform, std::ranges::for_each, std::ranges::fold_left,
 	std::views::repeat;
 using std::uniform_int_distribution,
 	std::integer_sequence, std::make_integer_sequence;
+using std::remove_cvref_t;
+
+namespace {
+
+DRR_SPLATTING_DEFINE_SCRATCH_MEMORY(ScratchMemory) {
+public:
+
+	DRR_SPLATTING_SCRATCH_MEMORY_CONTAINER_TRAIT;
+
+	using ExtentType = typename ContainerTrait::MaskOutputType::Dimension3Type;
+
+	typename ContainerTrait::KernelType Kernel;
+	typename ContainerTrait::MaskOutputType Output;
+
+	//Number of samples and kernels of the most recent invocation.
+	Stochastic::SizeType SampleCount {}, KernelCount {};
+
+	void resize(const ExtentType extent) {
+		this->Kernel.resize(extent.z);
+		this->Output.resize(extent);
+
+		this->SampleCount = 0U;
+		this->KernelCount = extent.x * extent.y;
+	}
+
+	[[nodiscard]] Stochastic::SizeType sizeByte() const noexcept {
+		return apply([](const auto&... member) static noexcept { return (member.sizeByte() + ...); }, tie(this->Kernel, this->Output));
+	}
+
+};
+
+//Half-width of the 95% confidence interval of the region mask of every region, with Agresti-Coull method.
+//Regions absent from the kernel are ignored, because any region present has a wider interval than that of an absent region.
+[[nodiscard]] double confidenceBound(const auto& kernel, const Stochastic::KernelSizeType sample_count) noexcept {
+	static constexpr double Z = 1.959963984540054, ZSquared = Z * Z;
+	const double adjusted_sample_count = sample_count + ZSquared;
 
-DRR_SPLATTING_DEFINE_DELEGATING_FUNCTOR(Stochastic) {
+	const double max_variance = fold_left(kernel.span() | std::views::transform([adjusted_sample_count](const auto& importance) {
+		const double count = [&importance] {
+			if constexpr (DisRegRep::Container::SparseMatrixElement::Is<remove_cvref_t<decltype(importance)>>) {
+				return importance.Value;
+			} else {
+				return importance;
+			}
+		}();
+		const double p = (count + ZSquared / 2.0) / adjusted_sample_count;
+		return p * (1.0 - p);
+	}), 0.0, std::ranges::max);
+	return Z * std::sqrt(max_variance / adjusted_sample_count);
+}
+
+}
+
+template<Random::IsEnginePolicy E>
+DRR_SPLATTING_DEFINE_DELEGATING_FUNCTOR(BasicStochastic<E>) {
 	this->validate(invoke_info, regionfield);
-	auto& [kernel_memory, output_memory] =
-		ImplementationHelper::PredefinedScratchMemory::allocateSimple<ContainerTrait>(invoke_info, regionfield, memory);
-
-	transform(this->convolve(Stochastic::IncludeOffsetEnumeration, invoke_info, regionfield), output_memory.range().begin(),
-		[
-			&kernel_memory,
-			secret = Stochastic::generateSecret(this->Seed),
-			sample_dist = uniform_int_distribution<KernelSizeType>(0U, this->diametre() - 1U),
-			sample_repetition = repeat(std::uint_least8_t {}, this->Sample),
-			norm_factor = this->Sample
-		](auto offset_kernel) mutable {
-			auto [offset, kernel] = std::move(offset_kernel);
-
-			kernel_memory.clear();
-			for_each(sample_repetition,
-				[
-					&kernel_memory,
-					&sample_dist,
-					kernel = std::move(kernel),
-					rng = Core::XXHash::RandomEngine(secret, auto(offset))
-				](auto) mutable {
-					using LengthType = DimensionType::length_type;
-					//It is too expensive to shuffle an index sequence than just taking some random samples from the kernel,
-					//	although that can avoid taking duplicate samples.
-					const DimensionType sample = [&]<LengthType... I>(integer_sequence<LengthType, I...>) {
-						return DimensionType(((void)I, sample_dist(rng))...);
-					}(make_integer_sequence<LengthType, DimensionType::length()> {});
-
-					kernel_memory.increment(kernel[sample.x][sample.y]);
-				});
-			return DisRegRep::Container::SplatKernel::toMask(kernel_memory, norm_factor);
-		});
+	auto& [kernel_memory, output_memory, total_sample_count, _1] = ImplementationHelper::allocate<ScratchMemory, ContainerTrait>(
+		memory, typename ScratchMemory<ContainerTrait>::ExtentType(invoke_info.Extent, regionfield.RegionCount));
+
+	this->convolve(BasicStochastic::IncludeOffsetEnumeration, invoke_info, regionfield, [&](auto kernel_range) {
+		transform(std::move(kernel_range), output_memory.range().begin(),
+			[
+				&kernel_memory,
+				&total_sample_count,
+				key = EnginePolicy::makeKey(BasicStochastic::generateSecret(this->Seed)),
+				sample_dist = uniform_int_distribution<KernelSizeType>(0U, this->diametre() - 1U),
+				batch_size = this->Sample,
+				//A non-adaptive sampler is equivalent to an adaptive sampler that always stops after the first batch.
+				maximum_sample = this->isAdaptive() ? this->MaximumSample : this->Sample,
+				tolerance = this->Tolerance,
+				sorted = invoke_info.Sorted
+			](auto offset_kernel) mutable {
+				const auto [offset, kernel] = std::move(offset_kernel);
+
+				kernel_memory.clear();
+				KernelSizeType sample_count {};
+				//The random state is carried over to the next batch, so the samples are the same as if they were taken in one batch.
+				for (auto rng = EnginePolicy::makeEngine(key, offset);;) {
+					for_each(repeat(std::uint_least8_t {}, std::ranges::min(batch_size, maximum_sample - sample_count)),
+						[&kernel_memory, &sample_dist, &kernel, &rng](auto) {
+							using LengthType = DimensionType::length_type;
+							//It is too expensive to shuffle an index sequence than just taking some random samples from the kernel,
+							//	although that can avoid taking duplicate samples.
+							const DimensionType sample = [&]<LengthType... I>(integer_sequence<LengthType, I...>) {
+								return DimensionType(((void)I, sample_dist(rng))...);
+							}(make_integer_sequence<LengthType, DimensionType::length()> {});
+
+							kernel_memory.increment(kernel[sample.x][sample.y]);
+						});
+					sample_count = std::ranges::min(sample_count + batch_size, maximum_sample);
+
+					if (sample_count == maximum_sample || confidenceBound(kernel_memory, sample_count) <= tolerance) {
+						break;
+					}
+				}
+
+				total_sample_count += sample_count;
+				return DisRegRep::Container::SplatKernel::toMask(kernel_memory, sample_count, sorted);
+			});
+	});
 	return output_memory;
 }
 
-void Stochastic::validate(const InvokeInfo& invoke_info, const Regionfield& regionfield) const {
+template<Random::IsEnginePolicy E>
+double BasicStochastic<E>::averageSample(const std::any& memory) const {
+	return ImplementationHelper::visit<ScratchMemory>(memory, [](const auto& scratch_memory) static noexcept {
+		return 1.0 * scratch_memory.SampleCount / scratch_memory.KernelCount;
+	});
+}
+
+template<Random::IsEnginePolicy E>
+void BasicStochastic<E>::validate(const InvokeInfo& invoke_info, const RegionfieldView regionfield) const {
 	this->Base::validate(invoke_info, regionfield);
 
 	DRR_ASSERT(this->Sample > 0U);
+	DRR_ASSERT(this->Tolerance >= 0.0F);
+	if (this->isAdaptive()) {
+		DRR_ASSERT(this->MaximumSample > 0U);
+	}
 }
 
-DRR_SPLATTING_DEFINE_SIZE_BYTE(Stochastic, Simple)
-DRR_SPLATTING_DEFINE_FUNCTOR_ALL(Stochastic)
\ No newline at end of file
+template<Random::IsEnginePolicy E>
+DRR_SPLATTING_DEFINE_SIZE_BYTE(BasicStochastic<E>, ScratchMemory)
+DRR_SPLATTING_DEFINE_FUNCTOR_ALL_TEMPLATE(template<Random::IsEnginePolicy E>, BasicStochastic<E>)
+
+#define INSTANTIATE(ENGINE) template class DisRegRep::Splatting::OccupancyConvolution::Sampled::BasicStochastic<Random::ENGINE>
+INSTANTIATE(XXH3);
+INSTANTIATE(SplitMix);
+INSTANTIATE(Squares);
\ No newline at end of file
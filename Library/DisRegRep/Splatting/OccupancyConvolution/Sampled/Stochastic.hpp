@@ -2,34 +2,72 @@
 
 #include "Base.hpp"
 
-#include <DisRegRep/Container/Regionfield.hpp>
+#include <DisRegRep/Container/RegionfieldView.hpp>
+#include <DisRegRep/Core/Random.hpp>
+#include <DisRegRep/Core/Type.hpp>
+
+#include <any>
+#include <string_view>
 
 namespace DisRegRep::Splatting::OccupancyConvolution::Sampled {
 
 /**
  * @brief Sample elements from the convolution kernel using a simple random sampling scheme. A fixed number of random samples are taken
  * among all elements in the kernel uniformly.
+ *
+ * Optionally, the number of samples can be adapted to every kernel. Samples are taken in batches, and no more batch is taken once the
+ * half-width of the 95% confidence interval of the estimated region mask of every region falls within a tolerance, or the maximum
+ * number of samples is reached. The interval is estimated with Agresti-Coull method, which is well-behaved when the kernel only
+ * covers a single region. Since the random state only depends on the kernel offset, the number of samples taken from each kernel is
+ * deterministic.
+ *
+ * @tparam E Policy of random engine used for taking samples.
  */
-class Stochastic final : public Base {
+template<Core::Random::IsEnginePolicy E>
+class BasicStochastic final : public Base {
 public:
 
-	KernelSizeType Sample = 1U; /**< Number of samples to be taken from the convolution kernel. */
+	using EnginePolicy = E;
+
+	KernelSizeType Sample = 1U; /**< Number of samples to be taken from the convolution kernel. It is the batch size if adaptive. */
 	SeedType Seed {}; /**< Seed the initial state of the stochastic region sampler. */
 
+	Core::Type::RegionMask Tolerance {}; /**< Adapt the number of samples to this error tolerance if positive. */
+	KernelSizeType MaximumSample = 1U; /**< Maximum number of samples to be taken from the convolution kernel if adaptive. */
+
 private:
 
+	static constexpr auto Name = Core::Random::appendSuffix<EnginePolicy>("S2");
+
 	DRR_SPLATTING_DECLARE_DELEGATING_FUNCTOR_IMPL;
 
-	void validate(const InvokeInfo&, const DisRegRep::Container::Regionfield&) const override;
+	void validate(const InvokeInfo&, DisRegRep::Container::RegionfieldView) const override;
 
 public:
 
-	DRR_SPLATTING_SET_INFO("S2", false)
+	DRR_SPLATTING_SET_INFO(std::string_view(Name.data(), Name.size()), false)
+
+	/**
+	 * @brief Check if the number of samples is adapted to every kernel.
+	 *
+	 * @return True if adaptive.
+	 */
+	[[nodiscard]] constexpr bool isAdaptive() const noexcept {
+		return this->Tolerance > 0.0F;
+	}
 
 	DRR_SPLATTING_DECLARE_SIZE_BYTE_IMPL;
 
+	[[nodiscard]] double averageSample(const std::any&) const override;
+
 	DRR_SPLATTING_DECLARE_FUNCTOR_ALL_IMPL;
 
 };
 
+extern template class BasicStochastic<Core::Random::XXH3>;
+extern template class BasicStochastic<Core::Random::SplitMix>;
+extern template class BasicStochastic<Core::Random::Squares>;
+
+using Stochastic = BasicStochastic<Core::Random::XXH3>;
+
 }
\ No newline at end of file
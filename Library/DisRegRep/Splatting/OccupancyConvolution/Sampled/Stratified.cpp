@@ -2,17 +2,19 @@
 #include <DisRegRep/Splatting/OccupancyConvolution/Sampled/Base.hpp>
 #include <DisRegRep/Splatting/ImplementationHelper.hpp>
 
-#include <DisRegRep/Container/Regionfield.hpp>
+#include <DisRegRep/Container/RegionfieldView.hpp>
 #include <DisRegRep/Container/SplatKernel.hpp>
 
 #include <DisRegRep/Core/View/Functional.hpp>
 #include <DisRegRep/Core/Exception.hpp>
-#include <DisRegRep/Core/XXHash.hpp>
+#include <DisRegRep/Core/Random.hpp>
 
 #include <glm/fwd.hpp>
 #include <glm/common.hpp>
 #include <glm/vec2.hpp>
 
+#include <any>
+#include <span>
 #include <tuple>
 
 #include <algorithm>
@@ -23,74 +25,122 @@
 
 #include <utility>
 
-using DisRegRep::Splatting::OccupancyConvolution::Sampled::Stratified,
+#include <cassert>
+
+using DisRegRep::Splatting::OccupancyConvolution::Sampled::BasicStratified, DisRegRep::Splatting::OccupancyConvolution::Sampled::Stratified,
 	DisRegRep::Splatting::ImplementationHelper::PredefinedScratchMemory::Simple,
-	DisRegRep::Container::Regionfield;
+	DisRegRep::Container::RegionfieldView;
+namespace Random = DisRegRep::Core::Random;
 
-using std::tuple;
+using std::span, std::tuple;
 using std::ranges::for_each,
 	std::bind_front, std::multiplies,
 	std::views::cartesian_product, std::views::iota, std::views::transform;
 using std::uniform_real_distribution;
 using std::integer_sequence, std::make_integer_sequence;
 
-DRR_SPLATTING_DEFINE_DELEGATING_FUNCTOR(Stratified) {
-	this->validate(invoke_info, regionfield);
-	auto& [kernel_memory, output_memory] =
-		ImplementationHelper::PredefinedScratchMemory::allocateSimple<ContainerTrait>(invoke_info, regionfield, memory);
+namespace {
 
-	using StratumExtentType = glm::f32vec2;
-	using LengthType = StratumExtentType::length_type;
-	const KernelSizeType d = this->diametre();
-	const auto stratum_extent = static_cast<StratumExtentType::value_type>(d) / this->StratumCount;
-	const auto stratum_bound =
-		[stratum_iota = iota(KernelSizeType {}, this->StratumCount)]<LengthType... I>(
+using StratumExtentType = glm::f32vec2;
+using LengthType = StratumExtentType::length_type;
+
+//Create a range of the lower and upper bound of every stratum in a kernel, in row-major order.
+[[nodiscard]] auto makeStratumBound(const Stratified::KernelSizeType d, const Stratified::KernelSizeType stratum_count) noexcept {
+	const auto stratum_extent = static_cast<StratumExtentType::value_type>(d) / stratum_count;
+	return [stratum_iota = iota(Stratified::KernelSizeType {}, stratum_count)]<LengthType... I>(
 			integer_sequence<LengthType, I...>) constexpr noexcept {
 			return cartesian_product(((void)I, stratum_iota)...);
 		}(make_integer_sequence<LengthType, StratumExtentType::length()> {})
-			| Core::View::Functional::MakeFromTuple<StratumExtentType>
+			| DisRegRep::Core::View::Functional::MakeFromTuple<StratumExtentType>
 			| transform(bind_front(multiplies {}, stratum_extent))
 			| transform([stratum_extent](const auto coord) constexpr noexcept { return tuple(coord, coord + stratum_extent); });
+}
+
+//Take a random sample from a stratum of a kernel, and return its coordinate relative to the kernel.
+template<Random::IsEnginePolicy E>
+[[nodiscard]] Stratified::DimensionType sampleStratum(
+	const typename E::KeyType& key,
+	const Stratified::KernelSizeType d,
+	const Stratified::DimensionType kernel_offset,
+	const tuple<StratumExtentType, StratumExtentType> bound
+) {
+	const auto [stratum_begin, stratum_end] = bound;
+
+	//Random state depends on both kernel and stratum offset,
+	//	to ensure they get distinct states if strata from different kernels overlap.
+	//Never use hash function directly on floating points due to rounding errors.
+	return [=, rng = E::makeEngine(key, kernel_offset, Stratified::DimensionType(stratum_begin))]
+		<LengthType... I>(integer_sequence<LengthType, I...>) mutable {
+			auto dist = tuple(uniform_real_distribution(stratum_begin[I], stratum_end[I])...);
+			//Need to use clamp to round coordinates to avoid out-of-bound access due to floating point inaccuracy
+			//	since max index should be one less than the size.
+			//This may introduce a tiny bias towards the lower and upper bound,
+			//	but should be negligible because round error is small.
+			return glm::clamp(Stratified::DimensionType(std::get<I>(dist)(rng)...), 0U, d - 1U);
+		}(make_integer_sequence<LengthType, StratumExtentType::length()> {});
+}
 
-	std::ranges::transform(this->convolve(Stratified::IncludeOffsetEnumeration, invoke_info, regionfield),
-		output_memory.range().begin(),
-		[
-			&kernel_memory,
-			d,
-			&stratum_bound,
-			secret = Stratified::generateSecret(this->Seed),
-			norm_factor = stratum_bound.size()
-		](auto offset_kernel) {
-			kernel_memory.clear();
-			for_each(stratum_bound, [&, d](const auto bound) {
-				const auto [kernel_offset, kernel] = std::move(offset_kernel);
-				const auto [stratum_begin, stratum_end] = bound;
-
-				//Random state depends on both kernel and stratum offset,
-				//	to ensure they get distinct states if strata from different kernels overlap.
-				//Never use hash function directly on floating points due to rounding errors.
-				const auto sample = [=,
-					rng = Core::XXHash::RandomEngine(secret, auto(kernel_offset), DimensionType(stratum_begin))]
-				<LengthType... I>(integer_sequence<LengthType, I...>) mutable {
-					auto dist = tuple(uniform_real_distribution(stratum_begin[I], stratum_end[I])...);
-					//Need to use clamp to round coordinates to avoid out-of-bound access due to floating point inaccuracy
-					//	since max index should be one less than the size.
-					//This may introduce a tiny bias towards the lower and upper bound,
-					//	but should be negligible because round error is small.
-					return glm::clamp(DimensionType(std::get<I>(dist)(rng)...), 0U, d - 1U);
-				}(make_integer_sequence<LengthType, StratumExtentType::length()> {});
-				kernel_memory.increment(kernel[sample.x][sample.y]);
+}
+
+template<Random::IsEnginePolicy E>
+DRR_SPLATTING_DEFINE_DELEGATING_FUNCTOR(BasicStratified<E>) {
+	this->validate(invoke_info, regionfield);
+	auto& [kernel_memory, output_memory] =
+		ImplementationHelper::PredefinedScratchMemory::allocateSimple<ContainerTrait>(invoke_info, regionfield, memory);
+
+	const KernelSizeType d = this->diametre();
+	const auto stratum_bound = makeStratumBound(d, this->StratumCount);
+
+	this->convolve(BasicStratified::IncludeOffsetEnumeration, invoke_info, regionfield, [&](auto kernel_range) {
+		std::ranges::transform(std::move(kernel_range),
+			output_memory.range().begin(),
+			[
+				&kernel_memory,
+				d,
+				&stratum_bound,
+				key = EnginePolicy::makeKey(BasicStratified::generateSecret(this->Seed)),
+				norm_factor = stratum_bound.size(),
+				sorted = invoke_info.Sorted
+			](auto offset_kernel) {
+				kernel_memory.clear();
+				for_each(stratum_bound, [&, d](const auto bound) {
+					const auto [kernel_offset, kernel] = std::move(offset_kernel);
+					const DimensionType sample = sampleStratum<EnginePolicy>(key, d, kernel_offset, bound);
+					kernel_memory.increment(kernel[sample.x][sample.y]);
+				});
+				return DisRegRep::Container::SplatKernel::toMask(kernel_memory, norm_factor, sorted);
 			});
-			return DisRegRep::Container::SplatKernel::toMask(kernel_memory, norm_factor);
-		});
+	});
 	return output_memory;
 }
 
-void Stratified::validate(const InvokeInfo& invoke_info, const Regionfield& regionfield) const {
+template<Random::IsEnginePolicy E>
+void BasicStratified<E>::sample(
+	const typename EnginePolicy::KeyType& key, const DimensionType kernel_offset, const span<DimensionType> sample) const {
+	const KernelSizeType d = this->diametre();
+	const auto stratum_bound = makeStratumBound(d, this->StratumCount);
+	assert(sample.size() >= stratum_bound.size());
+
+	std::ranges::transform(stratum_bound, sample.begin(), bind_front(sampleStratum<EnginePolicy>, std::cref(key), d, kernel_offset));
+}
+
+template<Random::IsEnginePolicy E>
+double BasicStratified<E>::averageSample(const std::any&) const {
+	return this->StratumCount * this->StratumCount;
+}
+
+template<Random::IsEnginePolicy E>
+void BasicStratified<E>::validate(const InvokeInfo& invoke_info, const RegionfieldView regionfield) const {
 	this->Base::validate(invoke_info, regionfield);
 
 	DRR_ASSERT(this->StratumCount > 0U);
 }
 
-DRR_SPLATTING_DEFINE_SIZE_BYTE(Stratified, Simple)
-DRR_SPLATTING_DEFINE_FUNCTOR_ALL(Stratified)
\ No newline at end of file
+template<Random::IsEnginePolicy E>
+DRR_SPLATTING_DEFINE_SIZE_BYTE(BasicStratified<E>, Simple)
+DRR_SPLATTING_DEFINE_FUNCTOR_ALL_TEMPLATE(template<Random::IsEnginePolicy E>, BasicStratified<E>)
+
+#define INSTANTIATE(ENGINE) template class DisRegRep::Splatting::OccupancyConvolution::Sampled::BasicStratified<Random::ENGINE>
+INSTANTIATE(XXH3);
+INSTANTIATE(SplitMix);
+INSTANTIATE(Squares);
\ No newline at end of file
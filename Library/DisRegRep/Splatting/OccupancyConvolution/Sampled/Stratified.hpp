@@ -2,34 +2,66 @@
 
 #include "Base.hpp"
 
-#include <DisRegRep/Container/Regionfield.hpp>
+#include <DisRegRep/Container/RegionfieldView.hpp>
+#include <DisRegRep/Core/Random.hpp>
+
+#include <any>
+#include <span>
+#include <string_view>
 
 namespace DisRegRep::Splatting::OccupancyConvolution::Sampled {
 
 /**
  * @brief Sample elements from the convolution kernel using a stratified sampling scheme. The kernel is divided into a number of
  * sub-kernels in equal-size, referred to strata, and one element is taken randomly from each stratum.
+ *
+ * @tparam E Policy of random engine used for taking samples.
  */
-class Stratified final : public Base {
+template<Core::Random::IsEnginePolicy E>
+class BasicStratified : public Base {
 public:
 
+	using EnginePolicy = E;
+
 	KernelSizeType StratumCount = 1U; /**< Specify the number of strata arranged along the extent of the kernel. */
 	SeedType Seed {}; /**< Seed the initial state of the stratified region sampler. */
 
 private:
 
+	static constexpr auto Name = Core::Random::appendSuffix<EnginePolicy>("S1");
+
 	DRR_SPLATTING_DECLARE_DELEGATING_FUNCTOR_IMPL;
 
-	void validate(const InvokeInfo&, const DisRegRep::Container::Regionfield&) const override;
+protected:
+
+	void validate(const InvokeInfo&, DisRegRep::Container::RegionfieldView) const override;
+
+	/**
+	 * @brief Take a random sample from every stratum of a kernel, the same way as the stratified sampler does.
+	 *
+	 * @param key Engine key generated from @link Seed.
+	 * @param kernel_offset Offset of the kernel on the regionfield, which is used to derive the random state.
+	 * @param sample Receives the coordinate relative to the kernel of the sample from each stratum, in row-major order of strata. Its
+	 * size must be no less than the total number of strata.
+	 */
+	void sample(const typename EnginePolicy::KeyType&, DimensionType, std::span<DimensionType>) const;
 
 public:
 
-	DRR_SPLATTING_SET_INFO("S1", false)
+	DRR_SPLATTING_SET_INFO(std::string_view(Name.data(), Name.size()), false)
 
 	DRR_SPLATTING_DECLARE_SIZE_BYTE_IMPL;
 
+	[[nodiscard]] double averageSample(const std::any&) const override;
+
 	DRR_SPLATTING_DECLARE_FUNCTOR_ALL_IMPL;
 
 };
 
+extern template class BasicStratified<Core::Random::XXH3>;
+extern template class BasicStratified<Core::Random::SplitMix>;
+extern template class BasicStratified<Core::Random::Squares>;
+
+using Stratified = BasicStratified<Core::Random::XXH3>;
+
 }
\ No newline at end of file
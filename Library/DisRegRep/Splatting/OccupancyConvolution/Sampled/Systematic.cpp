@@ -2,13 +2,15 @@
 #include <DisRegRep/Splatting/OccupancyConvolution/Sampled/Base.hpp>
 #include <DisRegRep/Splatting/ImplementationHelper.hpp>
 
-#include <DisRegRep/Container/Regionfield.hpp>
+#include <DisRegRep/Container/RegionfieldView.hpp>
 #include <DisRegRep/Container/SplatKernel.hpp>
 
 #include <DisRegRep/Core/Exception.hpp>
 
 #include <glm/vector_relational.hpp>
 
+#include <any>
+
 #include <algorithm>
 #include <functional>
 #include <ranges>
@@ -19,7 +21,7 @@
 
 using DisRegRep::Splatting::OccupancyConvolution::Sampled::Systematic,
 	DisRegRep::Splatting::ImplementationHelper::PredefinedScratchMemory::Simple,
-	DisRegRep::Container::Regionfield;
+	DisRegRep::Container::RegionfieldView;
 
 using std::ranges::for_each, std::ranges::fold_left_first,
 	std::bind_back, std::bit_or, std::plus,
@@ -34,30 +36,38 @@ DRR_SPLATTING_DEFINE_DELEGATING_FUNCTOR(Systematic) {
 	const DimensionType remained_size = d - this->FirstSample,
 		sample_size = (remained_size + this->Interval - 1U) / this->Interval;
 
-	std::ranges::transform(this->convolve(Systematic::ExcludeOffsetEnumeration, invoke_info, regionfield),
-		output_memory.range().begin(),
-		[
-			this,
-			&kernel_memory,
-			norm_factor = static_cast<typename decltype(output_memory)::ValueType>(sample_size.x * sample_size.y)
-		](auto kernel) noexcept {
-			auto kernel_pattern = std::move(kernel)
-				| drop(this->FirstSample.x)
-				| stride(this->Interval.x)
-				| transform(bind_back(bit_or {}, drop(this->FirstSample.y) | stride(this->Interval.y)));
-			//It is also possible calculate normalisation factor here with the following method, which is more intuitive.
-			//Doing it manually outside the loop to avoid making repetitive calculations.
-			assert(fold_left_first(kernel_pattern | transform(std::ranges::size), plus {}) == norm_factor);
-
-			kernel_memory.clear();
-			for_each(std::move(kernel_pattern) | join,
-				[&kernel_memory](const auto region_id) noexcept { kernel_memory.increment(region_id); });
-			return DisRegRep::Container::SplatKernel::toMask(kernel_memory, norm_factor);
-		});
+	this->convolve(Systematic::ExcludeOffsetEnumeration, invoke_info, regionfield, [&](auto kernel_range) {
+		std::ranges::transform(std::move(kernel_range),
+			output_memory.range().begin(),
+			[
+				this,
+				&kernel_memory,
+				norm_factor = static_cast<typename decltype(output_memory)::ValueType>(sample_size.x * sample_size.y),
+				sorted = invoke_info.Sorted
+			](auto kernel) noexcept {
+				auto kernel_pattern = std::move(kernel)
+					| drop(this->FirstSample.x)
+					| stride(this->Interval.x)
+					| transform(bind_back(bit_or {}, drop(this->FirstSample.y) | stride(this->Interval.y)));
+				//It is also possible calculate normalisation factor here with the following method, which is more intuitive.
+				//Doing it manually outside the loop to avoid making repetitive calculations.
+				assert(fold_left_first(kernel_pattern | transform(std::ranges::size), plus {}) == norm_factor);
+
+				kernel_memory.clear();
+				for_each(std::move(kernel_pattern) | join,
+					[&kernel_memory](const auto region_id) noexcept { kernel_memory.increment(region_id); });
+				return DisRegRep::Container::SplatKernel::toMask(kernel_memory, norm_factor, sorted);
+			});
+	});
 	return output_memory;
 }
 
-void Systematic::validate(const InvokeInfo& invoke_info, const Regionfield& regionfield) const {
+double Systematic::averageSample(const std::any&) const {
+	const DimensionType sample_size = (this->diametre() - this->FirstSample + this->Interval - 1U) / this->Interval;
+	return sample_size.x * sample_size.y;
+}
+
+void Systematic::validate(const InvokeInfo& invoke_info, const RegionfieldView regionfield) const {
 	this->Base::validate(invoke_info, regionfield);
 
 	using glm::all;
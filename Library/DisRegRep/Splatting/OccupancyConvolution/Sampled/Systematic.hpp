@@ -2,7 +2,9 @@
 
 #include "Base.hpp"
 
-#include <DisRegRep/Container/Regionfield.hpp>
+#include <DisRegRep/Container/RegionfieldView.hpp>
+
+#include <any>
 
 namespace DisRegRep::Splatting::OccupancyConvolution::Sampled {
 
@@ -10,7 +12,7 @@ namespace DisRegRep::Splatting::OccupancyConvolution::Sampled {
  * @brief Sample elements from the convolution kernel using a systematic sampling scheme, where elements are spaced in a regular
  * interval.
  */
-class Systematic final : public Base {
+class Systematic : public Base {
 public:
 
 	DimensionType FirstSample = DimensionType(0U), /**< Coordinate of the first sample in the convolution kernel. */
@@ -20,7 +22,9 @@ private:
 
 	DRR_SPLATTING_DECLARE_DELEGATING_FUNCTOR_IMPL;
 
-	void validate(const InvokeInfo&, const DisRegRep::Container::Regionfield&) const override;
+protected:
+
+	void validate(const InvokeInfo&, DisRegRep::Container::RegionfieldView) const override;
 
 public:
 
@@ -28,6 +32,8 @@ public:
 
 	DRR_SPLATTING_DECLARE_SIZE_BYTE_IMPL;
 
+	[[nodiscard]] double averageSample(const std::any&) const override;
+
 	DRR_SPLATTING_DECLARE_FUNCTOR_ALL_IMPL;
 
 };
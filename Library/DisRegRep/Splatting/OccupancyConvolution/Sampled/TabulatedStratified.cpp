@@ -0,0 +1,120 @@
+#include <DisRegRep/Splatting/OccupancyConvolution/Sampled/TabulatedStratified.hpp>
+#include <DisRegRep/Splatting/OccupancyConvolution/Sampled/Stratified.hpp>
+#include <DisRegRep/Splatting/ImplementationHelper.hpp>
+
+#include <DisRegRep/Container/RegionfieldView.hpp>
+#include <DisRegRep/Container/SplatKernel.hpp>
+
+#include <DisRegRep/Core/View/Functional.hpp>
+#include <DisRegRep/Core/Exception.hpp>
+
+#include <span>
+#include <vector>
+
+#include <optional>
+#include <tuple>
+
+#include <algorithm>
+#include <ranges>
+
+#include <utility>
+
+using DisRegRep::Splatting::OccupancyConvolution::Sampled::TabulatedStratified,
+	DisRegRep::Container::RegionfieldView;
+
+using std::span, std::vector,
+	std::optional, std::tuple, std::tie, std::apply;
+using std::ranges::for_each,
+	std::views::cartesian_product, std::views::iota, std::views::chunk, std::views::zip;
+
+namespace {
+
+DRR_SPLATTING_DEFINE_SCRATCH_MEMORY(ScratchMemory) {
+public:
+
+	DRR_SPLATTING_SCRATCH_MEMORY_CONTAINER_TRAIT;
+
+	using ExtentType = typename ContainerTrait::MaskOutputType::Dimension3Type;
+	//Seed, radius, stratum count and pattern period.
+	using PatternKeyType = tuple<
+		TabulatedStratified::SeedType,
+		TabulatedStratified::KernelSizeType,
+		TabulatedStratified::KernelSizeType,
+		TabulatedStratified::KernelSizeType
+	>;
+
+	typename ContainerTrait::KernelType Kernel;
+	typename ContainerTrait::MaskOutputType Output;
+
+	//Sample coordinates relative to the kernel, with shape (period, period, stratum count squared).
+	vector<TabulatedStratified::DimensionType> Pattern;
+	optional<PatternKeyType> PatternKey; /**< Parameters used to generate the current pattern table. */
+
+	void resize(const ExtentType extent) {
+		this->Kernel.resize(extent.z);
+		this->Output.resize(extent);
+	}
+
+	[[nodiscard]] TabulatedStratified::SizeType sizeByte() const noexcept {
+		return apply([](const auto&... member) static noexcept { return (member.sizeByte() + ...); }, tie(this->Kernel, this->Output))
+			+ span(this->Pattern).size_bytes();
+	}
+
+};
+
+}
+
+DRR_SPLATTING_DEFINE_DELEGATING_FUNCTOR(TabulatedStratified) {
+	this->validate(invoke_info, regionfield);
+	using CurrentScratchMemory = ScratchMemory<ContainerTrait>;
+	auto& [kernel_memory, output_memory, pattern_memory, pattern_key] = ImplementationHelper::allocate<ScratchMemory, ContainerTrait>(
+		memory, typename CurrentScratchMemory::ExtentType(invoke_info.Extent, regionfield.RegionCount));
+
+	const KernelSizeType period = this->PatternPeriod,
+		stratum_size = this->StratumCount * this->StratumCount;
+	if (const auto key = typename CurrentScratchMemory::PatternKeyType(this->Seed, this->Radius, this->StratumCount, period);
+		pattern_key != key) {
+		//Sample every stratum from kernels of offsets within one period, exactly as how the stratified sampler would do.
+		pattern_memory.resize(period * period * stratum_size);
+		const auto engine_key = EnginePolicy::makeKey(TabulatedStratified::generateSecret(this->Seed));
+		const auto period_iota = iota(KernelSizeType {}, period);
+		for (const auto [kernel_offset, pattern] : zip(
+			cartesian_product(period_iota, period_iota) | Core::View::Functional::MakeFromTuple<DimensionType>,
+			pattern_memory | chunk(stratum_size)
+		)) [[likely]] {
+			this->sample(engine_key, kernel_offset, span(pattern));
+		}
+		pattern_key.emplace(key);
+	}
+
+	this->convolve(TabulatedStratified::IncludeOffsetEnumeration, invoke_info, regionfield, [&](auto kernel_range) {
+		std::ranges::transform(std::move(kernel_range),
+			output_memory.range().begin(),
+			[
+				&kernel_memory,
+				pattern = span(std::as_const(pattern_memory)),
+				period,
+				stratum_size,
+				norm_factor = stratum_size,
+				sorted = invoke_info.Sorted
+			](auto offset_kernel) {
+				const auto [kernel_offset, kernel] = std::move(offset_kernel);
+				const DimensionType pattern_offset = kernel_offset % period;
+
+				kernel_memory.clear();
+				for_each(pattern.subspan((pattern_offset.x * period + pattern_offset.y) * stratum_size, stratum_size),
+					[&kernel_memory, &kernel](const auto sample) { kernel_memory.increment(kernel[sample.x][sample.y]); });
+				return DisRegRep::Container::SplatKernel::toMask(kernel_memory, norm_factor, sorted);
+			});
+	});
+	return output_memory;
+}
+
+void TabulatedStratified::validate(const InvokeInfo& invoke_info, const RegionfieldView regionfield) const {
+	this->Stratified::validate(invoke_info, regionfield);
+
+	DRR_ASSERT(this->PatternPeriod > 0U);
+}
+
+DRR_SPLATTING_DEFINE_SIZE_BYTE(TabulatedStratified, ScratchMemory)
+DRR_SPLATTING_DEFINE_FUNCTOR_ALL(TabulatedStratified)
\ No newline at end of file
@@ -0,0 +1,44 @@
+#pragma once
+
+#include "Stratified.hpp"
+
+#include <DisRegRep/Container/RegionfieldView.hpp>
+
+namespace DisRegRep::Splatting::OccupancyConvolution::Sampled {
+
+/**
+ * @brief A @link Stratified sampling whose sample pattern is precomputed into a table, such that taking samples from a kernel reduces
+ * to a table lookup instead of hashing a random state for every stratum. The table holds the sample pattern of kernels whose offsets
+ * lie within one period, and the pattern of any other kernel is taken from the one with the same offset modulo the period. The table
+ * is cached in the scratch memory and only regenerated when any parameter affecting the pattern changes.
+ *
+ * @note Every sample is still uniformly distributed within its stratum, so the estimated region occupancy of each individual kernel
+ * remains unbiased with the same variance as @link Stratified. However, kernels whose offsets are congruent modulo @link
+ * PatternPeriod share the same pattern and hence have correlated errors, which may appear as a periodic tiling artefact on the output.
+ * A larger period weakens the artefact at the cost of table memory, which is the square of both period and stratum count.
+ * Output is identical to @link Stratified if the period covers every kernel offset.
+ */
+class TabulatedStratified final : public Stratified {
+public:
+
+	KernelSizeType PatternPeriod = 1U; /**< Period of sample pattern along each axis of the regionfield. */
+
+private:
+
+	DRR_SPLATTING_DECLARE_DELEGATING_FUNCTOR_IMPL;
+
+protected:
+
+	void validate(const InvokeInfo&, DisRegRep::Container::RegionfieldView) const override;
+
+public:
+
+	DRR_SPLATTING_SET_INFO("S1+", false)
+
+	DRR_SPLATTING_DECLARE_SIZE_BYTE_IMPL;
+
+	DRR_SPLATTING_DECLARE_FUNCTOR_ALL_IMPL;
+
+};
+
+}
\ No newline at end of file
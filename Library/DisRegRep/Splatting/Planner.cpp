@@ -0,0 +1,181 @@
+#include <DisRegRep/Splatting/Planner.hpp>
+#include <DisRegRep/Splatting/Base.hpp>
+#include <DisRegRep/Splatting/Container.hpp>
+
+#include <DisRegRep/Container/Regionfield.hpp>
+
+#include <DisRegRep/Core/System/Processor.hpp>
+#include <DisRegRep/Core/Exception.hpp>
+
+#include <DisRegRep/RegionfieldGenerator/ExecutionPolicy.hpp>
+#include <DisRegRep/RegionfieldGenerator/Uniform.hpp>
+
+#include <glm/common.hpp>
+
+#include <any>
+#include <array>
+#include <span>
+#include <string>
+#include <string_view>
+#include <tuple>
+
+#include <algorithm>
+#include <functional>
+#include <ranges>
+
+#include <chrono>
+#include <istream>
+#include <ostream>
+#include <sstream>
+
+#include <bit>
+#include <limits>
+
+#include <cstdint>
+
+using DisRegRep::Splatting::Planner,
+	DisRegRep::Container::Regionfield;
+
+using std::any, std::array, std::span, std::string, std::string_view, std::tuple;
+using std::ranges::find, std::ranges::for_each,
+	std::mem_fn,
+	std::views::iota;
+using std::chrono::steady_clock,
+	std::istream, std::ostream, std::istringstream;
+
+namespace {
+
+constexpr char WisdomDelimiter = '\t';
+
+[[nodiscard]] constexpr std::uint_fast8_t log2Ceil(const std::uint_fast64_t value) noexcept {
+	return std::bit_width(std::ranges::max(value, std::uint_fast64_t { 1 }) - 1U);
+}
+
+[[nodiscard]] consteval auto makeTraitTag() noexcept {
+	return std::apply([](const auto... trait) static consteval noexcept {
+		return array { decltype(trait)::Tag... };
+	}, DisRegRep::Splatting::Container::Combination);
+}
+constexpr auto TraitTag = makeTraitTag(); /**< Indexed by @link Planner::TraitIndexType. */
+
+}
+
+Planner::Plan Planner::probe(
+	const Base::InvokeInfo& invoke_info, const KernelSizeType radius, const RegionCountType region_count) const {
+	const Base::InvokeInfo probe_info {
+		.Offset = DimensionType(radius),
+		.Extent = glm::min(invoke_info.Extent, this->ProbeExtent)
+	};
+	Regionfield regionfield;
+	regionfield.RegionCount = region_count;
+	regionfield.resize(probe_info.Offset + probe_info.Extent + radius);
+	static constexpr RegionfieldGenerator::Uniform Generator;
+	Generator(RegionfieldGenerator::ExecutionPolicy::SingleThreadingTrait, regionfield, { .Seed = 0U });
+
+	//Nothing is timed without a repetition, and no candidate would be chosen.
+	DRR_ASSERT(this->ProbeRepetition > 0U);
+
+	Plan fastest {};
+	auto fastest_time = steady_clock::duration::max();
+	for (OccupancyConvolution::Base* const splatting : this->Candidate) [[likely]] {
+		splatting->Radius = radius;
+		for (const auto trait_index : iota(TraitIndexType {}, static_cast<TraitIndexType>(TraitTag.size()))) [[likely]] {
+			Planner::visit(trait_index, [&](const auto trait) {
+				any memory;
+				//The first invocation allocates scratch memory, which is amortised in practice, so it is not timed.
+				static_cast<void>((*splatting)(trait, probe_info, regionfield, memory));
+				for_each(iota(std::uint_fast8_t {}, this->ProbeRepetition), [&](auto) {
+					const auto start = steady_clock::now();
+					static_cast<void>((*splatting)(trait, probe_info, regionfield, memory));
+					if (const auto time = steady_clock::now() - start;
+						time < fastest_time) {
+						fastest_time = time;
+						fastest = { splatting, trait_index };
+					}
+				});
+			});
+		}
+	}
+	return fastest;
+}
+
+Planner::Planner(const span<OccupancyConvolution::Base* const> candidate) :
+	Candidate(candidate), ProcessorModel(Core::System::Processor::getModelName()) {
+	DRR_ASSERT(!this->Candidate.empty());
+}
+
+Planner::Key Planner::makeKey(
+	const Base::InvokeInfo& invoke_info, const KernelSizeType radius, const RegionCountType region_count) noexcept {
+	const DimensionType extent = invoke_info.Extent;
+	return {
+		.Radius = log2Ceil(radius + 1U),
+		.RegionCount = log2Ceil(region_count),
+		.Extent = log2Ceil(std::uint_fast64_t { extent.x } * extent.y)
+	};
+}
+
+void Planner::importWisdom(istream& input) {
+	for (string line; std::getline(input, line);) [[likely]] {
+		if (line.empty()) [[unlikely]] {
+			continue;
+		}
+
+		auto entry = istringstream(std::move(line));
+		const auto field = [&entry] {
+			string value;
+			DRR_ASSERT(std::getline(entry, value, WisdomDelimiter));
+			return value;
+		};
+		const auto number = [&field] {
+			unsigned int value {};
+			DRR_ASSERT(istringstream(field()) >> value);
+			DRR_ASSERT(value <= std::numeric_limits<std::uint_fast8_t>::max());
+			return static_cast<std::uint_fast8_t>(value);
+		};
+
+		if (field() != this->ProcessorModel) {
+			continue;
+		}
+		//Function arguments are evaluated in an unspecified order, so read fields one by one.
+		Key key {};
+		key.Radius = number();
+		key.RegionCount = number();
+		key.Extent = number();
+		string name = field();
+		const auto trait = find(TraitTag, field());
+		DRR_ASSERT(trait != TraitTag.cend());
+
+		this->Wisdom.insert_or_assign(key, tuple(std::move(name), static_cast<TraitIndexType>(trait - TraitTag.cbegin())));
+	}
+}
+
+void Planner::exportWisdom(ostream& output) const {
+	for (const auto& [key, plan] : this->Wisdom) {
+		const auto& [name, trait] = plan;
+		output << this->ProcessorModel << WisdomDelimiter
+			<< static_cast<unsigned int>(key.Radius) << WisdomDelimiter
+			<< static_cast<unsigned int>(key.RegionCount) << WisdomDelimiter
+			<< static_cast<unsigned int>(key.Extent) << WisdomDelimiter
+			<< name << WisdomDelimiter
+			<< TraitTag[trait] << '\n';
+	}
+}
+
+Planner::Plan Planner::operator()(
+	const Base::InvokeInfo& invoke_info, const KernelSizeType radius, const RegionCountType region_count) {
+	const Key key = Planner::makeKey(invoke_info, radius, region_count);
+	if (const auto it = this->Wisdom.find(key);
+		it != this->Wisdom.cend()) {
+		const auto& [name, trait] = it->second;
+		if (const auto candidate = find(this->Candidate, string_view(name), mem_fn(&Base::name));
+			candidate != this->Candidate.end()) {
+			(*candidate)->Radius = radius;
+			return { *candidate, trait };
+		}
+	}
+
+	const Plan plan = this->probe(invoke_info, radius, region_count);
+	this->Wisdom.insert_or_assign(key, tuple(string(plan.Splatting->name()), plan.ContainerTrait));
+	plan.Splatting->Radius = radius;
+	return plan;
+}
\ No newline at end of file
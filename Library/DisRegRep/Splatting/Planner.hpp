@@ -0,0 +1,167 @@
+#pragma once
+
+#include "Base.hpp"
+#include "Container.hpp"
+
+#include "OccupancyConvolution/Base.hpp"
+
+#include <DisRegRep/Container/Regionfield.hpp>
+#include <DisRegRep/Core/Exception.hpp>
+
+#include <map>
+#include <span>
+#include <string>
+#include <tuple>
+
+#include <functional>
+
+#include <istream>
+#include <ostream>
+
+#include <compare>
+
+#include <cstdint>
+
+namespace DisRegRep::Splatting {
+
+/**
+ * @brief Choose the fastest combination of occupancy convolution and container trait for a problem at runtime, in a similar fashion as
+ * how FFTW plans a transform. Every candidate is timed on a small probe workload of the same radius and region count. The outcome,
+ * referred to as wisdom, is remembered for problems of similar size on the same processor model, and can be persisted to a file such
+ * that probing only needs to happen once per machine.
+ */
+class Planner {
+public:
+
+	using SizeType = Base::SizeType;
+	using DimensionType = Base::DimensionType;
+	using KernelSizeType = OccupancyConvolution::Base::KernelSizeType;
+	using RegionCountType = DisRegRep::Container::Regionfield::ValueType;
+	using TraitIndexType = std::uint_fast8_t; /**< Index into @link Container::Combination. */
+
+	/**
+	 * @brief Classify problems of similar size. Each member is the binary logarithm of its parameter rounded up.
+	 */
+	struct Key {
+
+		std::uint_fast8_t Radius, /**< Radius plus one. */
+			RegionCount, /**< Number of region. */
+			Extent; /**< Area of the splatting extent. */
+
+		[[nodiscard]] constexpr std::strong_ordering operator<=>(const Key&) const noexcept = default;
+
+	};
+
+	/**
+	 * @brief The fastest configuration for a problem.
+	 */
+	struct Plan {
+
+		OccupancyConvolution::Base* Splatting; /**< One of the candidates, whose radius has been set to that of the problem. */
+		TraitIndexType ContainerTrait;
+
+	};
+
+	DimensionType ProbeExtent = DimensionType(64U); /**< Maximum splatting extent of the probe workload. */
+	std::uint_fast8_t ProbeRepetition = 3U; /**< The fastest of this many timed invocations is taken for every candidate. Must be positive. */
+
+private:
+
+	std::span<OccupancyConvolution::Base* const> Candidate;
+	std::string ProcessorModel;
+
+	//Name of the splatting and index of the container trait.
+	std::map<Key, std::tuple<std::string, TraitIndexType>> Wisdom;
+
+	//Time every candidate and return the fastest.
+	[[nodiscard]] Plan probe(const Base::InvokeInfo&, KernelSizeType, RegionCountType) const;
+
+public:
+
+	/**
+	 * @brief Create a planner.
+	 *
+	 * @param candidate Splatting to be chosen from, which must have distinct names and must outlive the planner. Their radii are
+	 * overwritten by the planner.
+	 *
+	 * @exception Core::Exception If `candidate` is empty.
+	 */
+	explicit Planner(std::span<OccupancyConvolution::Base* const>);
+
+	Planner(const Planner&) = delete;
+
+	Planner(Planner&&) noexcept = default;
+
+	Planner& operator=(const Planner&) = delete;
+
+	Planner& operator=(Planner&&) noexcept = default;
+
+	~Planner() = default;
+
+	/**
+	 * @brief Classify a problem.
+	 *
+	 * @param invoke_info @link Base::InvokeInfo.
+	 * @param radius Radius of the convolution kernel.
+	 * @param region_count Number of region on the regionfield.
+	 *
+	 * @return Key of the problem.
+	 */
+	[[nodiscard]] static Key makeKey(const Base::InvokeInfo&, KernelSizeType, RegionCountType) noexcept;
+
+	/**
+	 * @brief Import wisdom previously exported. Wisdom of other processor models is ignored, and existing wisdom of the same key is
+	 * replaced.
+	 *
+	 * @param input Stream from which wisdom is read.
+	 *
+	 * @exception Core::Exception If wisdom is malformed.
+	 */
+	void importWisdom(std::istream&);
+
+	/**
+	 * @brief Export all wisdom. The format is text, with one entry per line in the form of tab-separated processor model, key,
+	 * splatting name and container trait tag.
+	 *
+	 * @param output Stream to which wisdom is written.
+	 */
+	void exportWisdom(std::ostream&) const;
+
+	/**
+	 * @brief Find the fastest configuration for a problem. Candidates are probed if there is no wisdom of this problem, or the wisdom
+	 * refers to a splatting which is not a candidate.
+	 *
+	 * @param invoke_info @link Base::InvokeInfo.
+	 * @param radius Radius of the convolution kernel.
+	 * @param region_count Number of region on the regionfield.
+	 *
+	 * @return The fastest configuration.
+	 *
+	 * @exception Core::Exception If candidates need to be probed but @link ProbeRepetition is zero.
+	 */
+	[[nodiscard]] Plan operator()(const Base::InvokeInfo&, KernelSizeType, RegionCountType);
+
+	/**
+	 * @brief Invoke a function with the container trait identified by an index.
+	 *
+	 * @tparam F Type of function.
+	 *
+	 * @param index @link TraitIndexType.
+	 * @param f Invoked with the container trait. Its return value is discarded, because it may have a different type for each
+	 * container trait.
+	 *
+	 * @exception Core::Exception If `index` is out of range.
+	 */
+	template<typename F>
+	static void visit(const TraitIndexType index, F&& f) {
+		using std::apply, std::invoke, std::tuple_size_v;
+
+		DRR_ASSERT(index < tuple_size_v<Container::CombinationType>);
+		apply([index, &f, i = TraitIndexType {}](const auto... trait) mutable {
+			static_cast<void>(((i++ == index && (static_cast<void>(invoke(f, trait)), true)) || ...));
+		}, Container::Combination);
+	}
+
+};
+
+}
\ No newline at end of file
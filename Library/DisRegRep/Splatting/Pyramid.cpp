@@ -0,0 +1,88 @@
+#include <DisRegRep/Splatting/Pyramid.hpp>
+#include <DisRegRep/Splatting/Container.hpp>
+
+#include <DisRegRep/Container/RegionfieldView.hpp>
+
+#include <DisRegRep/Core/Exception.hpp>
+
+#include <glm/common.hpp>
+#include <glm/vector_relational.hpp>
+
+#include <any>
+
+#include <algorithm>
+#include <functional>
+#include <ranges>
+
+using DisRegRep::Splatting::Pyramid,
+	DisRegRep::Container::RegionfieldView;
+
+using std::any;
+using std::ranges::fold_left, std::ranges::for_each, std::ranges::fill,
+	std::bind_back, std::mem_fn, std::plus, std::multiplies,
+	std::views::cartesian_product, std::views::iota, std::views::transform;
+
+namespace {
+
+//Halve the width and height of a region mask by box averaging.
+void reduce(const Pyramid::MaskType& source, Pyramid::MaskType& destination) {
+	using Dimension2Type = Pyramid::MaskType::Dimension2Type;
+	using Dimension3Type = Pyramid::MaskType::Dimension3Type;
+
+	const Dimension3Type source_extent = source.extent();
+	const Dimension2Type source_extent_2d = source_extent;
+	const Dimension2Type destination_extent = (source_extent_2d + 1U) / 2U;
+	destination.resize(Dimension3Type(destination_extent, source_extent.z));
+
+	const auto source_matrix = source.range2d();
+	const auto destination_matrix = destination.range2d();
+	for (const auto [x, y] : cartesian_product(iota(Dimension2Type::value_type {}, destination_extent.x),
+		iota(Dimension2Type::value_type {}, destination_extent.y))) [[likely]] {
+		const Dimension2Type first = Dimension2Type(x, y) * 2U,
+			last = glm::min(first + 2U, source_extent_2d),
+			box = last - first;
+
+		const auto value = *destination_matrix[x][y];
+		fill(value, Pyramid::MaskType::ValueType {});
+		for_each(cartesian_product(iota(first.x, last.x), iota(first.y, last.y)), [&source_matrix, &value](const auto coordinate) {
+			const auto [i, j] = coordinate;
+			std::ranges::transform(value, *source_matrix[i][j], value.begin(), plus {});
+		});
+		std::ranges::transform(value, value.begin(),
+			bind_back(multiplies {}, Pyramid::MaskType::ValueType { 1 } / static_cast<Pyramid::MaskType::ValueType>(box.x * box.y)));
+	}
+}
+
+}
+
+Pyramid::SizeType Pyramid::sizeByte() const noexcept {
+	return fold_left(this->Level_ | transform(mem_fn(&MaskType::sizeByte)), SizeType {}, plus {});
+}
+
+void Pyramid::operator()(const MaskType& base) {
+	DRR_ASSERT(!base.empty());
+
+	using Dimension2Type = MaskType::Dimension2Type;
+
+	this->LevelCount = 0U;
+	//Level memory may be reallocated when a new level is added, so do not hold a reference to the previous level.
+	const auto previous = [this, &base]() noexcept -> const MaskType& {
+		return this->LevelCount == 0U ? base : this->Level_[this->LevelCount - 1U];
+	};
+	while (this->LevelCount < this->MaximumLevel
+		&& glm::any(glm::greaterThan(Dimension2Type(previous().extent()), Dimension2Type(1U)))) [[likely]] {
+		if (this->LevelCount == this->Level_.size()) {
+			this->Level_.emplace_back();
+		}
+		//Each level is reduced from the previous one rather than the base level, so every level only reads a quarter of the data.
+		reduce(previous(), this->Level_[this->LevelCount]);
+		this->LevelCount++;
+	}
+}
+
+const Pyramid::MaskType& Pyramid::operator()(
+	const Base& splatting, const Base::InvokeInfo& invoke_info, const RegionfieldView regionfield, any& memory) {
+	const MaskType& base = splatting(Container::DenseKernelDenseOutputTrait, invoke_info, regionfield, memory);
+	(*this)(base);
+	return base;
+}
\ No newline at end of file
@@ -0,0 +1,93 @@
+#pragma once
+
+#include "Base.hpp"
+
+#include <DisRegRep/Container/RegionfieldView.hpp>
+#include <DisRegRep/Container/SplattingCoefficient.hpp>
+
+#include <vector>
+
+#include <any>
+#include <span>
+
+#include <limits>
+
+#include <cstdint>
+
+namespace DisRegRep::Splatting {
+
+/**
+ * @brief Build a chain of successively reduced region masks, a.k.a. a mip-pyramid, from a dense splatting output. Every level halves
+ * the width and height of its previous level, rounding up, by averaging region masks within a box of at most 2x2, until an extent of
+ * one is reached. Because every region mask of a splatting is normalised by the same kernel area, averaging region masks is equivalent
+ * to averaging region importance counts, so the reduction is exact rather than an approximation of a re-splatting.
+ */
+class Pyramid {
+public:
+
+	using SizeType = Base::SizeType;
+	using MaskType = DisRegRep::Container::SplattingCoefficient::DenseMask;
+	using LevelType = std::uint_fast8_t;
+
+private:
+
+	std::vector<MaskType> Level_; /**< Allocation is kept when the number of levels shrinks. */
+	LevelType LevelCount {};
+
+public:
+
+	LevelType MaximumLevel = std::numeric_limits<LevelType>::max(); /**< Maximum number of reduced levels, excluding the base level. */
+
+	constexpr Pyramid() = default;
+
+	Pyramid(const Pyramid&) = delete;
+
+	Pyramid(Pyramid&&) noexcept = default;
+
+	Pyramid& operator=(const Pyramid&) = delete;
+
+	Pyramid& operator=(Pyramid&&) noexcept = default;
+
+	~Pyramid() = default;
+
+	/**
+	 * @brief Get reduced levels of the pyramid.
+	 *
+	 * @return Reduced levels, from the finest to the coarsest. The base level is not included.
+	 */
+	[[nodiscard]] std::span<const MaskType> level() const noexcept {
+		return std::span(this->Level_).first(this->LevelCount);
+	}
+
+	/**
+	 * @brief Query the memory usage of all levels, including those allocated but currently not in use.
+	 *
+	 * @return Memory usage in bytes.
+	 */
+	[[nodiscard]] SizeType sizeByte() const noexcept;
+
+	/**
+	 * @brief Build reduced levels from a base level.
+	 *
+	 * @param base Region mask of the base level, which is not modified nor copied.
+	 *
+	 * @exception Core::Exception If `base` is empty.
+	 */
+	void operator()(const MaskType&);
+
+	/**
+	 * @brief Compute region feature splatting coefficients with dense containers, and build reduced levels directly from the output in
+	 * scratch memory while it is still hot in cache.
+	 *
+	 * @param splatting Splatting method.
+	 * @param invoke_info @link Base::InvokeInfo.
+	 * @param regionfield Regionfield to be splatted.
+	 * @param memory Scratch memory of the splatting.
+	 *
+	 * @return Region mask of the base level, which is owned by `memory`.
+	 */
+	const MaskType& operator()(const Base&, const Base::InvokeInfo&, DisRegRep::Container::RegionfieldView, std::any&);
+
+};
+
+}
\ No newline at end of file
@@ -0,0 +1,158 @@
+#pragma once
+
+#include "Base.hpp"
+#include "Container.hpp"
+
+#include <DisRegRep/Container/RegionfieldView.hpp>
+#include <DisRegRep/Container/SplattingCoefficient.hpp>
+
+#include <DisRegRep/Core/Exception.hpp>
+#include <DisRegRep/Core/Type.hpp>
+
+#include <any>
+#include <mdspan>
+
+#include <algorithm>
+#include <ranges>
+
+#include <concepts>
+#include <limits>
+
+#include <cassert>
+#include <cmath>
+
+/**
+ * @brief Deliver region masks produced by a splatting into a caller-provided buffer, such as a pinned upload buffer or a shared memory
+ * segment, without taking the output out of the scratch memory of the splatting. The buffer is described by an mdspan with axes of
+ * width, height and region count, whose layout and accessor are chosen by the caller.
+ */
+namespace DisRegRep::Splatting::Transfer {
+
+using IndexType = DisRegRep::Container::SplattingCoefficient::Type::IndexType;
+using ExtentType = std::dextents<IndexType, 3U>;
+
+/**
+ * `V` is a value type that a region mask can be transferred as. Unsigned integers are quantised as unsigned normalised fixed points.
+ */
+template<typename V>
+concept Value = std::floating_point<V> || std::unsigned_integral<V>;
+
+/**
+ * @brief Buffer of region masks.
+ *
+ * @tparam V Value type.
+ * @tparam Layout Layout policy.
+ * @tparam Accessor Accessor policy.
+ */
+template<Value V, typename Layout = std::layout_right, typename Accessor = std::default_accessor<V>>
+using OutputType = std::mdspan<V, ExtentType, Layout, Accessor>;
+
+namespace Internal_ {
+
+//Every region is present in each element of a dense or planar region mask.
+template<typename Mask>
+inline constexpr bool IsDenseLayout =
+	DisRegRep::Container::SplattingCoefficient::IsDense<Mask> || DisRegRep::Container::SplattingCoefficient::IsPlanar<Mask>;
+
+}
+
+/**
+ * @brief Convert a region mask to a value in the buffer.
+ *
+ * @tparam V Value type.
+ *
+ * @param mask Region mask.
+ *
+ * @return `mask` converted to `V`.
+ */
+template<Value V>
+[[nodiscard]] constexpr V encode(const Core::Type::RegionMask mask) noexcept {
+	if constexpr (std::floating_point<V>) {
+		return static_cast<V>(mask);
+	} else {
+		//Single precision cannot represent the maximum of a wide integer, and the rounded value may exceed it.
+		static constexpr V Maximum = std::numeric_limits<V>::max();
+		if (const double value = std::round(static_cast<double>(mask) * Maximum);
+			value < static_cast<double>(Maximum)) [[likely]] {
+			return static_cast<V>(std::ranges::max(value, 0.0));
+		}
+		return Maximum;
+	}
+}
+
+/**
+ * @brief Copy region masks into a buffer. Regions absent from a sparse region mask are written as zeros.
+ *
+ * @tparam Mask Region mask type.
+ * @tparam V, Layout, Accessor @link OutputType.
+ *
+ * @param mask Region mask to be copied.
+ * @param output Buffer to be written to, which must have the same width and height as `mask`, and have enough regions to hold every
+ * region of `mask`. For a dense or planar region mask, the number of regions must be the same.
+ */
+template<DisRegRep::Container::SplattingCoefficient::Is Mask, Value V, typename Layout, typename Accessor>
+void copy(const Mask& mask, const OutputType<V, Layout, Accessor> output) {
+	using std::views::cartesian_product, std::views::enumerate, std::views::iota, std::views::zip;
+	static constexpr bool IsDenseLayout = Internal_::IsDenseLayout<Mask>;
+
+	const auto extent = typename Mask::Dimension2Type(mask.extent());
+	DRR_ASSERT(output.extent(0U) == extent.x && output.extent(1U) == extent.y);
+	const IndexType region_count = output.extent(2U);
+	if constexpr (IsDenseLayout) {
+		DRR_ASSERT(region_count == mask.extent().z);
+	}
+
+	for (const auto [coordinate, proxy] : zip(cartesian_product(iota(IndexType {}, extent.x), iota(IndexType {}, extent.y)),
+		mask.range())) [[likely]] {
+		const auto [x, y] = coordinate;
+		if constexpr (IsDenseLayout) {
+			for (const auto [region, value] : *proxy | enumerate) {
+				output[x, y, static_cast<IndexType>(region)] = Transfer::encode<V>(value);
+			}
+		} else {
+			for (const auto region : iota(IndexType {}, region_count)) {
+				output[x, y, region] = V {};
+			}
+			for (const auto [region, value] : *proxy) {
+				assert(region < region_count);
+				output[x, y, region] = Transfer::encode<V>(value);
+			}
+		}
+	}
+}
+
+/**
+ * @brief Invoke a splatting and write its region masks into a buffer. The output remains in `memory`, so scratch memory is reused as
+ * usual by subsequent invocations.
+ *
+ * @tparam ContainerTrait Container trait of the splatting.
+ * @tparam V, Layout, Accessor @link OutputType.
+ *
+ * @param splatting Splatting method.
+ * @param container_trait Specify the container trait.
+ * @param invoke_info @link Base::InvokeInfo.
+ * @param regionfield Regionfield to be splatted.
+ * @param memory Scratch memory of the splatting.
+ * @param output Buffer to be written to. Its width and height are those of the splatting output, meaning they are swapped if the
+ * splatting is transposed. It must have as many regions as `regionfield` for a dense or planar region mask, or at least as many
+ * regions otherwise, the same as @link copy.
+ */
+template<Container::IsTrait ContainerTrait, Value V, typename Layout, typename Accessor>
+void splat(
+	const Base& splatting,
+	const ContainerTrait container_trait,
+	const Base::InvokeInfo& invoke_info,
+	const DisRegRep::Container::RegionfieldView regionfield,
+	std::any& memory,
+	const OutputType<V, Layout, Accessor> output
+) {
+	//Region count of a sparse region mask is only known from the regionfield, so it cannot be checked by `copy`.
+	if constexpr (Internal_::IsDenseLayout<typename ContainerTrait::MaskOutputType>) {
+		DRR_ASSERT(output.extent(2U) == regionfield.RegionCount);
+	} else {
+		DRR_ASSERT(output.extent(2U) >= regionfield.RegionCount);
+	}
+	Transfer::copy(splatting(container_trait, invoke_info, regionfield, memory), output);
+}
+
+}
\ No newline at end of file
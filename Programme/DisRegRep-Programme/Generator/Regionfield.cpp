@@ -3,6 +3,8 @@
 #include <DisRegRep/Container/Regionfield.hpp>
 #include <DisRegRep/Container/SplattingCoefficient.hpp>
 
+#include <DisRegRep/Core/Exception.hpp>
+
 #include <DisRegRep/RegionfieldGenerator/Base.hpp>
 #include <DisRegRep/RegionfieldGenerator/DiamondSquare.hpp>
 #include <DisRegRep/RegionfieldGenerator/ExecutionPolicy.hpp>
@@ -10,18 +12,27 @@
 #include <DisRegRep/RegionfieldGenerator/VoronoiDiagram.hpp>
 
 #include <DisRegRep/Splatting/OccupancyConvolution/Full/Fast.hpp>
+#include <DisRegRep/Splatting/OccupancyConvolution/Sampled/LowDiscrepancy.hpp>
+#include <DisRegRep/Splatting/OccupancyConvolution/Sampled/SlidingSystematic.hpp>
 #include <DisRegRep/Splatting/OccupancyConvolution/Sampled/Stochastic.hpp>
 #include <DisRegRep/Splatting/OccupancyConvolution/Sampled/Stratified.hpp>
 #include <DisRegRep/Splatting/OccupancyConvolution/Sampled/Systematic.hpp>
 #include <DisRegRep/Splatting/OccupancyConvolution/Base.hpp>
 #include <DisRegRep/Splatting/Base.hpp>
+#include <DisRegRep/Splatting/Batch.hpp>
 #include <DisRegRep/Splatting/Container.hpp>
 
-#include <any>
+#include <vector>
+
 #include <optional>
+#include <span>
 #include <tuple>
 #include <variant>
 
+#include <algorithm>
+#include <functional>
+#include <ranges>
+
 #include <utility>
 
 namespace RfGen = DisRegRep::Programme::Generator::Regionfield;
@@ -29,12 +40,17 @@ namespace StockGen = DisRegRep::RegionfieldGenerator;
 namespace StockSplt = DisRegRep::Splatting;
 using DisRegRep::Container::Regionfield, DisRegRep::Container::SplattingCoefficient::DenseMask;
 
-using std::any, std::optional, std::tuple, std::visit;
+using std::vector,
+	std::optional, std::span, std::tuple, std::visit;
+using std::ranges::all_of, std::ranges::for_each, std::ranges::max, std::ranges::to,
+	std::bind_front, std::equal_to,
+	std::views::transform, std::views::zip;
 
 namespace {
 
 using PreparedGenerationInfo = tuple<const StockGen::Base::GenerateInfo, Regionfield>;
-using PreparedSplatInfo = tuple<const RfGen::SplatInfo&, const Regionfield&>;
+using DenseMaskArray = vector<DenseMask>;
+using PreparedSplatInfo = tuple<const RfGen::SplatInfo&, span<const Regionfield>, StockSplt::Batch&>;
 using PreparedOccupancyConvolutionSplatInfo = tuple<const RfGen::Splatting::OccupancyConvolution::SplatInfo, PreparedSplatInfo>;
 
 [[nodiscard]] Regionfield generate(
@@ -65,30 +81,46 @@ using PreparedOccupancyConvolutionSplatInfo = tuple<const RfGen::Splatting::Occu
 }
 
 //NOLINTNEXTLINE(cppcoreguidelines-rvalue-reference-param-not-moved)
-[[nodiscard]] DenseMask splat(const StockSplt::Base& splatting, PreparedSplatInfo&& prepared_splat_info) {
-	const auto [splat_info, regionfield] = prepared_splat_info;
+[[nodiscard]] DenseMaskArray splat(const StockSplt::Base& splatting, PreparedSplatInfo&& prepared_splat_info) {
+	auto& [splat_info, regionfield, batch] = prepared_splat_info;
 	const auto [offset, extent] = splat_info;
+	DRR_ASSERT(!regionfield.empty());
 
-	const auto invoke_splat = [&splatting, &offset, &extent](const Regionfield& regionfield) -> DenseMask {
-		const StockSplt::Base::DimensionType
-			invoke_offset = *offset.or_else([&splatting] { return optional(splatting.minimumOffset()); }),
-			invoke_extent = *extent.or_else([&] { return optional(splatting.maximumExtent(regionfield, invoke_offset)); });
-
-		any memory;
-		return std::move(splatting(StockSplt::Container::DenseKernelDenseOutputTrait, StockSplt::Base::InvokeInfo {
-			.Offset = invoke_offset,
-			.Extent = invoke_extent
-		}, regionfield, memory));
-	};
 	//Remember to transpose the input to maintain the same axes order if the splatting algorithm would do so.
+	vector<Regionfield> regionfield_transposed;
 	if (splatting.isTransposed()) {
-		return invoke_splat(regionfield.transpose());
-	} else {//NOLINT(readability-else-after-return)
-		return invoke_splat(regionfield);
+		regionfield_transposed = regionfield | transform(&Regionfield::transpose) | to<vector>();
 	}
+	const auto invoke_regionfield = splatting.isTransposed() ? span<const Regionfield>(regionfield_transposed) : regionfield;
+
+	const Regionfield& regionfield_front = invoke_regionfield.front();
+	//All regionfields in a batch share the same invoke info.
+	DRR_ASSERT(all_of(invoke_regionfield, bind_front(equal_to {}, regionfield_front.extent()), &Regionfield::extent));
+	const StockSplt::Base::DimensionType
+		invoke_offset = *offset.or_else([&splatting] { return optional(splatting.minimumOffset()); }),
+		invoke_extent = *extent.or_else([&] { return optional(splatting.maximumExtent(regionfield_front, invoke_offset)); });
+	const StockSplt::Base::InvokeInfo invoke_info {
+		.Offset = invoke_offset,
+		.Extent = invoke_extent
+	};
+
+	//Output is copied rather than moved, such that it remains allocated in the scratch memory for the next invocation.
+	auto dense_mask = DenseMaskArray(invoke_regionfield.size());
+	auto sink = [&dense_mask](const StockSplt::Batch::SizeType index, const DenseMask& mask) -> void {
+		DenseMask& copied = dense_mask[index];
+		copied.resize(mask.extent());
+		for_each(zip(copied.range(), mask.range()), [](const auto proxy) static {
+			const auto [copied_proxy, mask_proxy] = proxy;
+			copied_proxy = *mask_proxy;
+		});
+	};
+	//Every output is dense, so the kernel can be the smallest one that holds every region of the batch.
+	StockSplt::Container::dispatchDenseOutput(max(invoke_regionfield | transform(&Regionfield::RegionCount)),
+		[&](const auto container_trait) { batch(splatting, container_trait, invoke_info, invoke_regionfield, sink); });
+	return dense_mask;
 }
 
-[[nodiscard]] DenseMask splat(
+[[nodiscard]] DenseMaskArray splat(
 	StockSplt::OccupancyConvolution::Base& splatting, PreparedOccupancyConvolutionSplatInfo&& prepared_oc_splat_info) {
 	auto [splat_info, prepared_splat_info] = std::move(prepared_oc_splat_info);
 	const auto [radius] = splat_info;
@@ -96,12 +128,12 @@ using PreparedOccupancyConvolutionSplatInfo = tuple<const RfGen::Splatting::Occu
 	return splat(splatting, std::move(prepared_splat_info));
 }
 
-[[nodiscard]] DenseMask splat(
+[[nodiscard]] DenseMaskArray splat(
 	PreparedOccupancyConvolutionSplatInfo&& prepared_oc_splat_info, RfGen::Splatting::OccupancyConvolution::Full) {
 	StockSplt::OccupancyConvolution::Full::Fast full;
 	return splat(full, std::move(prepared_oc_splat_info));
 }
-[[nodiscard]] DenseMask splat(PreparedOccupancyConvolutionSplatInfo&& prepared_oc_splat_info,
+[[nodiscard]] DenseMaskArray splat(PreparedOccupancyConvolutionSplatInfo&& prepared_oc_splat_info,
 	const RfGen::Splatting::OccupancyConvolution::Sampled::Stochastic* const option) {
 	const auto [sample, seed] = *option;
 	StockSplt::OccupancyConvolution::Sampled::Stochastic stochastic;
@@ -109,7 +141,7 @@ using PreparedOccupancyConvolutionSplatInfo = tuple<const RfGen::Splatting::Occu
 	stochastic.Seed = seed;
 	return splat(stochastic, std::move(prepared_oc_splat_info));
 }
-[[nodiscard]] DenseMask splat(PreparedOccupancyConvolutionSplatInfo&& prepared_oc_splat_info,
+[[nodiscard]] DenseMaskArray splat(PreparedOccupancyConvolutionSplatInfo&& prepared_oc_splat_info,
 	const RfGen::Splatting::OccupancyConvolution::Sampled::Stratified* const option) {
 	const auto [stratum_count, seed] = *option;
 	StockSplt::OccupancyConvolution::Sampled::Stratified stratified;
@@ -117,14 +149,23 @@ using PreparedOccupancyConvolutionSplatInfo = tuple<const RfGen::Splatting::Occu
 	stratified.Seed = seed;
 	return splat(stratified, std::move(prepared_oc_splat_info));
 }
-[[nodiscard]] DenseMask splat(PreparedOccupancyConvolutionSplatInfo&& prepared_oc_splat_info,
+[[nodiscard]] DenseMaskArray splat(PreparedOccupancyConvolutionSplatInfo&& prepared_oc_splat_info,
 	const RfGen::Splatting::OccupancyConvolution::Sampled::Systematic* const option) {
 	const auto [first_sample, interval] = *option;
-	StockSplt::OccupancyConvolution::Sampled::Systematic systematic;
+	//Output is identical to the plain systematic sampling, but faster.
+	StockSplt::OccupancyConvolution::Sampled::SlidingSystematic systematic;
 	systematic.FirstSample = first_sample;
 	systematic.Interval = interval;
 	return splat(systematic, std::move(prepared_oc_splat_info));
 }
+[[nodiscard]] DenseMaskArray splat(PreparedOccupancyConvolutionSplatInfo&& prepared_oc_splat_info,
+	const RfGen::Splatting::OccupancyConvolution::Sampled::LowDiscrepancy* const option) {
+	const auto [sample, seed] = *option;
+	StockSplt::OccupancyConvolution::Sampled::LowDiscrepancy low_discrepancy;
+	low_discrepancy.Sample = sample;
+	low_discrepancy.Seed = seed;
+	return splat(low_discrepancy, std::move(prepared_oc_splat_info));
+}
 
 }
 
@@ -143,7 +184,10 @@ Regionfield RfGen::generate(const GenerateInfo& gen_info, const Generator::Optio
 	);
 }
 
-DenseMask RfGen::splat(const SplatInfo& splat_info, const Splatting::Option& option, const ::Regionfield& regionfield) {
+namespace {
+
+[[nodiscard]] DenseMaskArray splat(const RfGen::SplatInfo& splat_info, const RfGen::Splatting::Option& option,
+	const span<const Regionfield> regionfield, StockSplt::Batch& batch) {
 	return visit(
 		[&](const auto& splatting_group) {
 			const auto& [group_splat_info, option] = splatting_group;
@@ -151,7 +195,7 @@ DenseMask RfGen::splat(const SplatInfo& splat_info, const Splatting::Option& opt
 				[&](const auto& splatting) {
 					return ::splat(PreparedOccupancyConvolutionSplatInfo(
 						*group_splat_info,
-						PreparedSplatInfo(splat_info, regionfield)
+						PreparedSplatInfo(splat_info, regionfield, batch)
 					), splatting);
 				},
 				option
@@ -159,4 +203,17 @@ DenseMask RfGen::splat(const SplatInfo& splat_info, const Splatting::Option& opt
 		},
 		option
 	);
+}
+
+}
+
+DenseMask RfGen::splat(const SplatInfo& splat_info, const Splatting::Option& option, const ::Regionfield& regionfield) {
+	//Each thread keeps its own executor, such that scratch memory is not reallocated by every invocation.
+	thread_local StockSplt::Batch batch;
+	return std::move(::splat(splat_info, option, span(&regionfield, 1U), batch).front());
+}
+
+DenseMaskArray RfGen::splat(const SplatInfo& splat_info, const Splatting::Option& option,
+	const span<const ::Regionfield> regionfield, StockSplt::Batch& batch) {
+	return ::splat(splat_info, option, regionfield, batch);
 }
\ No newline at end of file
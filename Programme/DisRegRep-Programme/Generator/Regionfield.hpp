@@ -7,14 +7,17 @@
 #include <DisRegRep/RegionfieldGenerator/DiamondSquare.hpp>
 #include <DisRegRep/RegionfieldGenerator/VoronoiDiagram.hpp>
 
+#include <DisRegRep/Splatting/OccupancyConvolution/Sampled/LowDiscrepancy.hpp>
 #include <DisRegRep/Splatting/OccupancyConvolution/Sampled/Stochastic.hpp>
 #include <DisRegRep/Splatting/OccupancyConvolution/Sampled/Stratified.hpp>
 #include <DisRegRep/Splatting/OccupancyConvolution/Sampled/Systematic.hpp>
 #include <DisRegRep/Splatting/OccupancyConvolution/Base.hpp>
+#include <DisRegRep/Splatting/Batch.hpp>
 
 #include <vector>
 
 #include <optional>
+#include <span>
 #include <tuple>
 #include <variant>
 
@@ -129,6 +132,17 @@ struct Systematic {
 	Splatting::DimensionType FirstSample, /**< @link Splatting::FirstSample. */
 		Interval; /**< @link Splatting::Interval. */
 
+};
+/**
+ * @brief Low-discrepancy sampling.
+ */
+struct LowDiscrepancy {
+
+	using Splatting = DisRegRep::Splatting::OccupancyConvolution::Sampled::LowDiscrepancy;
+
+	Splatting::KernelSizeType Sample; /**< @link Splatting::Sample. */
+	Splatting::SeedType Seed; /**< @link Splatting::Seed. */
+
 };
 
 }
@@ -137,7 +151,8 @@ using Option = std::variant<
 	Full,
 	const Sampled::Stochastic*,
 	const Sampled::Stratified*,
-	const Sampled::Systematic*
+	const Sampled::Systematic*,
+	const Sampled::LowDiscrepancy*
 >; /**< All occupancy convolution-based splatting algorithms. */
 
 }
@@ -184,7 +199,8 @@ struct SplatInfo {
 [[nodiscard]] Container::Regionfield generate(const GenerateInfo&, const Generator::Option&);
 
 /**
- * @brief Compute region feature splatting coefficients for the whole domain of a given regionfield matrix.
+ * @brief Compute region feature splatting coefficients for the whole domain of a given regionfield matrix. Scratch memory is reused
+ * across invocations on the same thread.
  *
  * @param splat_info @link SplatInfo.
  * @param option Choose a region feature splatting coefficient algorithm.
@@ -195,4 +211,18 @@ struct SplatInfo {
 [[nodiscard]] Container::SplattingCoefficient::DenseMask splat(
 	const SplatInfo&, const Splatting::Option&, const Container::Regionfield&);
 
+/**
+ * @brief Compute region feature splatting coefficients for the whole domain of every regionfield matrix in a batch. Scratch memory is
+ * reused by each thread of the executor across the batch, as well as across every batch given to the same executor.
+ *
+ * @param splat_info @link SplatInfo. If extent is not provided, it is derived from the first regionfield.
+ * @param option Choose a region feature splatting coefficient algorithm.
+ * @param regionfield Batch of regionfield inputs. All regionfields must have the same dimension.
+ * @param batch Batch splatting executor.
+ *
+ * @return The computed dense region masks, in the same order as `regionfield`.
+ */
+[[nodiscard]] std::vector<Container::SplattingCoefficient::DenseMask> splat(
+	const SplatInfo&, const Splatting::Option&, std::span<const Container::Regionfield>, DisRegRep::Splatting::Batch&);
+
 }
\ No newline at end of file
@@ -16,6 +16,8 @@
 #include <DisRegRep/Image/Serialisation/Protocol.hpp>
 #include <DisRegRep/Image/Tiff.hpp>
 
+#include <DisRegRep/Splatting/Pyramid.hpp>
+
 #include <DisRegRep/Info.hpp>
 
 #include <CLI/CLI.hpp>
@@ -360,17 +362,19 @@ struct Splat {
 		Full,
 		Stochastic,
 		Stratified,
-		Systematic
+		Systematic,
+		LowDiscrepancy
 	};
 	vector<Splatting> Splatting_;
 
 	Generator::Regionfield::SplatInfo SplatInfo;
-	bool CentreSplattingArea;
+	bool CentreSplattingArea, MaskPyramid;
 
 	Generator::Regionfield::Splatting::OccupancyConvolution::SplatInfo OCSplatInfo;
 	Generator::Regionfield::Splatting::OccupancyConvolution::Sampled::Stochastic StochasticSampled;
 	Generator::Regionfield::Splatting::OccupancyConvolution::Sampled::Stratified StratifiedSampled;
 	Generator::Regionfield::Splatting::OccupancyConvolution::Sampled::Systematic SystematicSampled;
+	Generator::Regionfield::Splatting::OccupancyConvolution::Sampled::LowDiscrepancy LowDiscrepancySampled;
 
 	constexpr Splat() noexcept = default;
 
@@ -391,10 +395,16 @@ struct Splat {
 		auto& [sample, seed_stochastic] = this->StochasticSampled;
 		auto& [stratum_count, seed_stratified] = this->StratifiedSampled;
 		auto& [first_sample, interval] = this->SystematicSampled;
+		auto& [sample_low_discrepancy, seed_low_discrepancy] = this->LowDiscrepancySampled;
 
+		using SampleType = common_type_t<
+			decltype(sample),
+			decltype(sample_low_discrepancy)
+		>;
 		using SeedType = common_type_t<
 			decltype(seed_stochastic),
-			decltype(seed_stratified)
+			decltype(seed_stratified),
+			decltype(seed_low_discrepancy)
 		>;
 		using ExtentType = common_type_t<
 			decltype(offset)::value_type,
@@ -430,7 +440,8 @@ struct Splat {
 				{ "full", Full },
 				{ "stochastic", Stochastic },
 				{ "stratified", Stratified },
-				{ "systematic", Systematic }
+				{ "systematic", Systematic },
+				{ "low-discrepancy", LowDiscrepancy }
 			}));
 
 		CLI::Option& opt_offset = *cmd.add_option_function<optional<ExtentArray>>(
@@ -460,6 +471,11 @@ struct Splat {
 		)
 			->needs(&opt_extent)
 			->excludes(&opt_offset);
+		cmd.add_flag(
+			"--pyramid",
+			this->MaskPyramid,
+			"Every mask is reduced repeatedly to half of its size until it becomes a single pixel, and the reduced masks are written as SubIFDs such that coarse levels can be loaded without reading the full resolution mask."
+		);
 
 		//It is not easy to pick a default radius, since it depends on the dimension of the regionfield matrix.
 		//It is an error if the convolution kernel is too large and goes over the matrix boundary.
@@ -473,9 +489,10 @@ struct Splat {
 			->check(CLI::NonNegativeNumber);
 		cmd.add_option_function<SeedType>(
 			"--seed",
-			[&seed_stochastic, &seed_stratified](const SeedType seed) constexpr noexcept {
+			[&seed_stochastic, &seed_stratified, &seed_low_discrepancy](const SeedType seed) constexpr noexcept {
 				seed_stochastic = seed;
 				seed_stratified = seed;
+				seed_low_discrepancy = seed;
 			},
 			"[Sampled Occupancy Convolution] The initial state of the random sampler may be seeded."
 		)
@@ -485,10 +502,13 @@ struct Splat {
 
 		//The number **5** is a magic number here,
 		//	which is the typical kernel diametre where the fast convolution starts to out-performs the vanilla convolution.
-		cmd.add_option(
+		cmd.add_option_function<SampleType>(
 			"--sample",
-			sample,
-			"[Stochastic Sampling] Specify the number of random elements to be extracted from the convolution kernel."
+			[&sample, &sample_low_discrepancy](const SampleType sample_count) constexpr noexcept {
+				sample = sample_count;
+				sample_low_discrepancy = sample_count;
+			},
+			"[Stochastic/Low-Discrepancy Sampling] Specify the number of elements to be extracted from the convolution kernel."
 		)
 			->type_name("SAMPLE")
 			->check(CLI::PositiveNumber)
@@ -551,6 +571,7 @@ struct Splat {
 			case Stochastic: return option_oc(&this->StochasticSampled);
 			case Stratified: return option_oc(&this->StratifiedSampled);
 			case Systematic: return option_oc(&this->SystematicSampled);
+			case LowDiscrepancy: return option_oc(&this->LowDiscrepancySampled);
 			default: std::unreachable();
 			}
 		}(), regionfield);
@@ -611,7 +632,15 @@ void splatRegionfield(const Argument::Splat& arg_splat, const Argument::TiffComp
 	const auto write_info = DenseMaskProtocol::WriteInfo {
 		.Compression = arg_tiff_compression.compressionSchemeOption()
 	};
-	if (const auto splatting_count = splatting.size();
+	if (arg_splat.MaskPyramid) {
+		//Reduced levels are SubIFDs of their base level, so masks are written one after the other.
+		DisRegRep::Splatting::Pyramid pyramid;
+		for (const auto method : splatting) {
+			const auto dense_mask = arg_splat.splatRegionfield(regionfield, method);
+			pyramid(dense_mask);
+			DenseMaskProtocol::write(dense_mask_tif, dense_mask, pyramid.level(), std::to_underlying(method), write_info);
+		}
+	} else if (const auto splatting_count = splatting.size();
 		splatting_count == 1U) {
 		const Argument::Splat::Splatting splatting_only_one = splatting.front();
 		DenseMaskProtocol::write(dense_mask_tif, arg_splat.splatRegionfield(regionfield, splatting_only_one),
@@ -5,6 +5,7 @@
 #include <DisRegRep/Container/Regionfield.hpp>
 
 #include <DisRegRep/Core/System/ProcessThreadControl.hpp>
+#include <DisRegRep/Core/Random.hpp>
 #include <DisRegRep/Core/View/Arithmetic.hpp>
 #include <DisRegRep/Core/View/Functional.hpp>
 #include <DisRegRep/Core/Exception.hpp>
@@ -15,6 +16,9 @@
 
 #include <DisRegRep/Splatting/OccupancyConvolution/Full/Fast.hpp>
 #include <DisRegRep/Splatting/OccupancyConvolution/Full/Vanilla.hpp>
+#include <DisRegRep/Splatting/OccupancyConvolution/Sampled/Stochastic.hpp>
+#include <DisRegRep/Splatting/OccupancyConvolution/Sampled/Stratified.hpp>
+#include <DisRegRep/Splatting/OccupancyConvolution/Sampled/TabulatedStratified.hpp>
 #include <DisRegRep/Splatting/OccupancyConvolution/Base.hpp>
 #include <DisRegRep/Splatting/Base.hpp>
 
@@ -122,7 +126,11 @@ void Drv::splatting(const SplattingInfo& info) {
 		RegionfieldGenerator::Uniform,
 		RegionfieldGenerator::VoronoiDiagram,
 		Splt::OccupancyConvolution::Full::Fast,
-		Splt::OccupancyConvolution::Full::Vanilla;
+		Splt::OccupancyConvolution::Full::Vanilla,
+		Splt::OccupancyConvolution::Sampled::BasicStochastic,
+		Splt::OccupancyConvolution::Sampled::Stochastic,
+		Splt::OccupancyConvolution::Sampled::Stratified,
+		Splt::OccupancyConvolution::Sampled::TabulatedStratified;
 
 	const tuple default_variable_radius = [&default_variable] {
 		const auto& [variable_radius, _1, _2] = default_variable;
@@ -164,9 +172,29 @@ void Drv::splatting(const SplattingInfo& info) {
 	const array default_rf_ptr = viewArray(default_rf);
 	const array stress_rf_ptr = viewArray(stress_rf);
 
-	const tuple default_fixed_radius = [radius = default_fixed.Radius] constexpr noexcept {
-		tuple<Vanilla, Fast> splatting;
+	const tuple default_fixed_radius = [&default_fixed, seed] noexcept {
+		const auto [_1, radius, _2, _3, stratum_count, pattern_period, sample_count, maximum_sample_count, sample_tolerance] =
+			default_fixed;
+		//Stochastic sampler creates an engine for every kernel, so the counter-based random engines are compared on it.
+		tuple<
+			Vanilla, Fast,
+			Stochastic, BasicStochastic<Core::Random::SplitMix>, BasicStochastic<Core::Random::Squares>,
+			Stratified, TabulatedStratified
+		> splatting;
 		apply([radius](auto&... current_splatting) constexpr noexcept { ((current_splatting.Radius = radius), ...); }, splatting);
+
+		auto& [_4, _5, stochastic, stochastic_sm, stochastic_sq, stratified, tabulated_stratified] = splatting;
+		//Stochastic sampler is profiled in adaptive mode, whose average number of samples is reported.
+		apply([&](auto&... current_stochastic) constexpr noexcept {
+			((current_stochastic.Sample = sample_count), ...);
+			((current_stochastic.MaximumSample = maximum_sample_count), ...);
+			((current_stochastic.Tolerance = sample_tolerance), ...);
+			((current_stochastic.Seed = seed), ...);
+		}, tie(stochastic, stochastic_sm, stochastic_sq));
+		//Compare the stratified sampler with and without sample pattern table.
+		stratified.StratumCount = tabulated_stratified.StratumCount = stratum_count;
+		stratified.Seed = tabulated_stratified.Seed = seed;
+		tabulated_stratified.PatternPeriod = pattern_period;
 		return splatting;
 	}();
 	const array default_fixed_radius_ptr = viewTuple<Splt::Base>(default_fixed_radius);
@@ -240,6 +268,11 @@ void Drv::splatting(const SplattingInfo& info) {
 		.CommonSweepInfo_ = &default_common_info,
 		.RegionCount = default_fixed.RegionCount
 	});
+	profiler.sweepRegionfieldLayout(default_fixed_radius_ptr, {
+		.CommonSweepInfo_ = &default_common_info,
+		.RegionCount = default_fixed.RegionCount,
+		.Input = span(&default_voronoi_rf_gen_ptr, 1U)
+	});
 	profiler.synchronise(progress_log);
 }
 
@@ -258,7 +291,12 @@ bool YAML::convert<Drv::SplattingInfo::ParameterSetType>::decode(const Node& nod
 				.Extent = default_fixed["extent"].as<Splatting::DimensionType>(),
 				.Radius = default_fixed["radius"].as<Splatting::KernelSizeType>(),
 				.RegionCount = default_fixed["region count"].as<Splatting::RegionCountType>(),
-				.CentroidCount = default_fixed["centroid count"].as<Splatting::CentroidCountType>()
+				.CentroidCount = default_fixed["centroid count"].as<Splatting::CentroidCountType>(),
+				.StratumCount = default_fixed["stratum count"].as<Splatting::KernelSizeType>(),
+				.PatternPeriod = default_fixed["pattern period"].as<Splatting::KernelSizeType>(),
+				.SampleCount = default_fixed["sample count"].as<Splatting::KernelSizeType>(),
+				.MaximumSampleCount = default_fixed["maximum sample count"].as<Splatting::KernelSizeType>(),
+				.SampleTolerance = default_fixed["sample tolerance"].as<DisRegRep::Core::Type::RegionMask>()
 			},
 			.Variable = {
 				.Radius = default_variable["radius"].as<Drv::LinearSweepVariable<Splatting::KernelSizeType>>(),
@@ -3,6 +3,7 @@
 #include "Splatting.hpp"
 
 #include <DisRegRep/Core/System/ProcessThreadControl.hpp>
+#include <DisRegRep/Core/Type.hpp>
 
 #include <yaml-cpp/yaml.h>
 
@@ -50,6 +51,12 @@ struct SplattingInfo {
 				Splatting::RegionCountType RegionCount;
 				Splatting::CentroidCountType CentroidCount;
 
+				Splatting::KernelSizeType StratumCount; /**< Stratum count of stratified sampled splatting. */
+				Splatting::KernelSizeType PatternPeriod; /**< Sample pattern table period of stratified sampled splatting. */
+				Splatting::KernelSizeType SampleCount, /**< Sample batch size of adaptive stochastic sampled splatting. */
+					MaximumSampleCount; /**< Maximum sample count of adaptive stochastic sampled splatting. */
+				Core::Type::RegionMask SampleTolerance; /**< Error tolerance of adaptive stochastic sampled splatting. */
+
 			} Fixed;
 			struct {
 
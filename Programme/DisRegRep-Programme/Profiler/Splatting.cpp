@@ -1,17 +1,21 @@
 #include <DisRegRep-Programme/Profiler/Splatting.hpp>
 
+#include <DisRegRep/Container/PackedRegionfield.hpp>
 #include <DisRegRep/Container/Regionfield.hpp>
+#include <DisRegRep/Container/RegionfieldView.hpp>
 #include <DisRegRep/Container/SplattingCoefficient.hpp>
 
 #include <DisRegRep/Core/System/ProcessThreadControl.hpp>
 #include <DisRegRep/Core/View/Functional.hpp>
 #include <DisRegRep/Core/Exception.hpp>
+#include <DisRegRep/Core/MdSpan.hpp>
 #include <DisRegRep/Core/ThreadPool.hpp>
 
 #include <DisRegRep/RegionfieldGenerator/Base.hpp>
 #include <DisRegRep/RegionfieldGenerator/ExecutionPolicy.hpp>
 #include <DisRegRep/RegionfieldGenerator/VoronoiDiagram.hpp>
 
+#include <DisRegRep/Splatting/OccupancyConvolution/Sampled/Base.hpp>
 #include <DisRegRep/Splatting/OccupancyConvolution/Base.hpp>
 #include <DisRegRep/Splatting/Base.hpp>
 #include <DisRegRep/Splatting/Container.hpp>
@@ -21,6 +25,7 @@
 #include <nanobench.h>
 
 #include <array>
+#include <mdspan>
 #include <vector>
 
 #include <span>
@@ -68,14 +73,14 @@ namespace Splt = DisRegRep::Splatting;
 namespace nb = ankerl::nanobench;
 
 namespace fs = std::filesystem;
-using std::array, std::to_array, std::vector,
+using std::array, std::to_array, std::mdspan, std::vector,
 	std::span, std::string, std::string_view,
 	std::any,
 	std::tuple, std::apply, std::tuple_cat;
 using std::ranges::copy, std::ranges::for_each, std::ranges::fold_left_first,
 	std::invoke, std::bind_back,
 	std::ostreambuf_iterator, std::back_inserter, std::make_const_iterator,
-	std::views::single, std::views::repeat, std::views::transform, std::views::cartesian_product,
+	std::views::single, std::views::repeat, std::views::iota, std::views::transform, std::views::cartesian_product,
 	std::views::join_with, std::views::zip, std::views::chunk, std::views::enumerate;
 using std::ranges::range_value_t, std::ranges::range_reference_t, std::ranges::range_const_reference_t,
 	std::ranges::input_range, std::ranges::view;
@@ -184,6 +189,7 @@ public:
 		>;
 
 		MemoryUsageType MemoryUsage;
+		double AverageSample; /**< Only available to sampled splatting, otherwise NaN. */
 
 	};
 
@@ -216,7 +222,11 @@ public:
 		}
 
 		void record(const Splt::Base& splatting_base, const any& memory) {
-			this->Array.emplace_back(splatting_base.sizeByte(memory));
+			const auto* const sampled = dynamic_cast<const Splt::OccupancyConvolution::Sampled::Base*>(&splatting_base);
+			this->Array.emplace_back(
+				splatting_base.sizeByte(memory),
+				sampled ? sampled->averageSample(memory) : numeric_limits<double>::quiet_NaN()
+			);
 		}
 
 		[[nodiscard]] constexpr SizeType size() const noexcept {
@@ -290,7 +300,8 @@ private:
 		static constexpr auto Header = to_array<string_view>({
 			"variable",
 			"t_median",
-			"memory"
+			"memory",
+			"sample"
 		});
 
 	public:
@@ -330,7 +341,7 @@ private:
 
 			for (const auto& [bench_result, extra_result] : zip(bench_result_array, extra_result_array.view())) [[likely]] {
 				const nb::Config& config = bench_result.config();
-				const auto [memory_usage] = extra_result;
+				const auto [memory_usage, average_sample] = extra_result;
 
 				const auto cast_time = [target_time_unit = config.mTimeUnit](
 										   const auto tick) constexpr noexcept -> NanoBenchDefaultDuration::rep {
@@ -338,10 +349,11 @@ private:
 				};
 
 				using enum nb::Result::Measure;
-				println(result, "{},{:.2f},{:.0f}",
+				println(result, "{},{:.2f},{:.0f},{:.2f}",
 					config.mBenchmarkName,
 					cast_time(bench_result.median(elapsed)),
-					memory_usage * (1.0F * DefaultMemoryUnit::den / DefaultMemoryUnit::num)
+					memory_usage * (1.0F * DefaultMemoryUnit::den / DefaultMemoryUnit::num),
+					average_sample
 				);
 			}
 		}
@@ -699,4 +711,62 @@ void Splatting::sweepCentroidCount(const span<const Splt::Base* const> splat, co
 		.Splatting_ = ToSplatting2dRange(splat),
 		.Tag = tag
 	}, Splt::Container::Combination);
+}
+
+void Splatting::sweepRegionfieldLayout(const span<const Splt::Base* const> splat, const RegionfieldLayoutSweepInfo& info) const {
+	const auto [common_info, region_count, input] = info;
+	const auto& [tag, rf_gen_info, extent] = *common_info;
+
+	this->Impl_->submit([
+		&impl = *this->Impl_,
+		region_count,
+		rf_gen_info,
+		invoke_info = Splt::Base::InvokeInfo {
+			.Offset = maximinOffset(splat),
+			.Extent = extent
+		}
+	](const auto container_trait, const auto&& profile_info) {
+		const auto& [_1, rf_gen, rf, splat_outer, extra_result, _2] = profile_info;
+		const Splt::Base& splat = *splat_outer.front();
+
+		rf->resize(splat.minimumRegionfieldDimension(invoke_info));
+		rf->RegionCount = region_count;
+		impl.generateRegionfield(*rf_gen, *rf, *rf_gen_info);
+		//Transposing a view of the transposed copy gives back the same matrix, but its column is no longer of unit stride.
+		const Container::Regionfield rf_transposed = rf->transpose();
+		const Container::RegionfieldView::BlockedMappingType blocked_mapping(Core::MdSpan::toExtent(rf->extent()));
+		auto rf_blocked = vector<Container::Regionfield::ValueType>(blocked_mapping.required_span_size());
+		const auto rf_md = rf->mdspan();
+		for (const auto rf_blocked_md = mdspan(rf_blocked.data(), blocked_mapping);
+			const auto [x, y] : cartesian_product(iota(Container::Regionfield::IndexType {}, rf_md.extent(0U)),
+				iota(Container::Regionfield::IndexType {}, rf_md.extent(1U)))) [[likely]] {
+			rf_blocked_md[x, y] = rf_md[x, y];
+		}
+		Container::PackedRegionfield rf_packed;
+		rf_packed.pack(*rf);
+		const auto rf_layout = to_array<tuple<const char*, Container::RegionfieldView>>({
+			{ "Contiguous", *rf },
+			{ "Strided", Container::RegionfieldView(rf_transposed).transpose() },
+			{ "Blocked", Container::RegionfieldView(
+				Container::RegionfieldView::BlockedMdSpanType(rf_blocked.data(), blocked_mapping), rf->RegionCount) },
+			{ "Packed", rf_packed }
+		});
+
+		nb::Bench bench = createBenchmark();
+		bench.title("RegionfieldLayout");
+
+		for (any memory;
+			const auto& [layout, rf_view] : rf_layout) [[likely]] {
+			bench.run(layout, [&invoke_info, container_trait, &rf_view, &splat, &memory] {
+				nb::doNotOptimizeAway(splat(container_trait, invoke_info, rf_view, memory));
+			});
+			extra_result->record(splat, memory);
+		}
+		impl.writeResult(container_trait, bench, profile_info);
+	}, Impl::SubmitInfo {
+		.RegionfieldGenerator_ = input,
+		.Regionfield = Impl::UseBuiltInRegionfield,
+		.Splatting_ = ToSplatting2dRange(splat),
+		.Tag = tag
+	}, Splt::Container::Combination);
 }
\ No newline at end of file
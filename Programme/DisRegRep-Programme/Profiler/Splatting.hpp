@@ -97,6 +97,14 @@ public:
 
 	};
 
+	struct RegionfieldLayoutSweepInfo {
+
+		const CommonSweepInfo* CommonSweepInfo_;
+		RegionCountType RegionCount; /**< @link Container::Regionfield::RegionCount. */
+		std::span<const RegionfieldGenerator::Base* const> Input;
+
+	};
+
 private:
 
 	class Impl;
@@ -172,6 +180,17 @@ public:
 	void sweepCentroidCount(
 		std::span<const DisRegRep::Splatting::Base* const>, std::span<const CentroidCountType>, const CentroidCountSweepInfo&) const;
 
+	/**
+	 * @brief Profile the impact of runtime by varying the memory layout of a regionfield, while the region identifiers remain the same.
+	 * Every layout, including a blocked and a bit-packed one, is read through a @link Container::RegionfieldView, and the regionfield is
+	 * automatically generated. Profiler will be executed by the order of the cartesian product of $splat \times info.Input$, and all layouts are run in
+	 * order within each job.
+	 *
+	 * @param splat Splatting to be profiled.
+	 * @param info @link RegionfieldLayoutSweepInfo.
+	 */
+	void sweepRegionfieldLayout(std::span<const DisRegRep::Splatting::Base* const>, const RegionfieldLayoutSweepInfo&) const;
+
 };
 
 }
\ No newline at end of file
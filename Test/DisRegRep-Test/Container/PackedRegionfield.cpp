@@ -0,0 +1,105 @@
+#include <DisRegRep/Container/PackedRegionfield.hpp>
+#include <DisRegRep/Container/Regionfield.hpp>
+
+#include <DisRegRep/Core/View/Matrix.hpp>
+
+#include <DisRegRep/RegionfieldGenerator/ExecutionPolicy.hpp>
+#include <DisRegRep/RegionfieldGenerator/Uniform.hpp>
+
+#include <catch2/generators/catch_generators_adapters.hpp>
+#include <catch2/generators/catch_generators_random.hpp>
+#include <catch2/matchers/catch_matchers_container_properties.hpp>
+#include <catch2/matchers/catch_matchers_range_equals.hpp>
+
+#include <catch2/catch_get_random_seed.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <glm/gtc/type_ptr.hpp>
+
+#include <ranges>
+
+#include <cstdint>
+
+namespace RfGenExec = DisRegRep::RegionfieldGenerator::ExecutionPolicy;
+using DisRegRep::Container::PackedRegionfield, DisRegRep::Container::Regionfield,
+	DisRegRep::RegionfieldGenerator::Uniform;
+
+using Catch::Matchers::IsEmpty, Catch::Matchers::RangeEquals;
+
+using glm::make_vec2;
+
+using std::views::join;
+
+SCENARIO("PackedRegionfield stores region identifiers with the minimum number of bits", "[Container][PackedRegionfield]") {
+
+	GIVEN("A default constructed packed regionfield") {
+		PackedRegionfield packed_rf;
+
+		THEN("It is empty") {
+			REQUIRE(packed_rf.empty());
+			REQUIRE(packed_rf.sizeByte() == 0U);
+			REQUIRE_THAT(packed_rf.range2d(), IsEmpty());
+		}
+
+		AND_GIVEN("A regionfield with few regions") {
+			static constexpr Uniform Generator;
+
+			Regionfield rf;
+			rf.resize(make_vec2(GENERATE(take(3U, chunk(2U, random<std::uint_least8_t>(5U, 40U)))).data()));
+			rf.RegionCount = GENERATE(values<Regionfield::ValueType>({ 2U, 4U, 16U }));
+			Generator(RfGenExec::MultiThreadingTrait, rf, {
+				.Seed = Catch::getSeed()
+			});
+
+			WHEN("Regionfield is packed") {
+				packed_rf.pack(rf);
+
+				THEN("Informative fields are retained") {
+					CHECK(packed_rf.RegionCount == rf.RegionCount);
+					CHECK(packed_rf.extent() == rf.extent());
+				}
+
+				THEN("Each region identifier takes no more bits than necessary") {
+					const auto bps = packed_rf.bitPerSample().Bit;
+					CHECK((1U << bps) >= rf.RegionCount);
+					CHECK(packed_rf.sizeByte() < rf.span().size_bytes());
+				}
+
+				THEN("Region identifiers are unpacked on access") {
+					CHECK_THAT(packed_rf.range2d() | join, RangeEquals(rf.range2d() | join));
+				}
+
+				THEN("Matrix can be unpacked to a regionfield") {
+					Regionfield unpacked_rf;
+					packed_rf.unpack(unpacked_rf);
+					CHECK(unpacked_rf == rf);
+				}
+
+				THEN("A window of matrix can be unpacked to a regionfield") {
+					const Regionfield::DimensionType extent = rf.extent(),
+						window_offset = extent / 3U,
+						window_extent = extent - window_offset - extent / 4U;
+
+					Regionfield unpacked_rf;
+					packed_rf.unpack(unpacked_rf, window_offset, window_extent);
+					CHECK(unpacked_rf.extent() == window_extent);
+					CHECK_THAT(unpacked_rf.range2d() | join,
+						RangeEquals(rf.range2d() | DisRegRep::Core::View::Matrix::Slice2d(window_offset, window_extent) | join));
+				}
+
+				AND_WHEN("Window goes out of bound") {
+
+					THEN("Matrix cannot be unpacked") {
+						Regionfield unpacked_rf;
+						CHECK_THROWS(packed_rf.unpack(unpacked_rf, rf.extent() / 2U, rf.extent()));
+					}
+
+				}
+
+			}
+
+		}
+
+	}
+
+}
\ No newline at end of file
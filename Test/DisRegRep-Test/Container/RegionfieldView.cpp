@@ -0,0 +1,154 @@
+#include <DisRegRep/Container/PackedRegionfield.hpp>
+#include <DisRegRep/Container/RegionfieldView.hpp>
+#include <DisRegRep/Container/Regionfield.hpp>
+
+#include <DisRegRep/Core/View/Matrix.hpp>
+#include <DisRegRep/Core/MdSpan.hpp>
+
+#include <DisRegRep/RegionfieldGenerator/ExecutionPolicy.hpp>
+#include <DisRegRep/RegionfieldGenerator/Uniform.hpp>
+
+#include <catch2/generators/catch_generators_adapters.hpp>
+#include <catch2/generators/catch_generators_random.hpp>
+#include <catch2/matchers/catch_matchers_container_properties.hpp>
+#include <catch2/matchers/catch_matchers_range_equals.hpp>
+#include <catch2/matchers/catch_matchers_string.hpp>
+
+#include <catch2/catch_get_random_seed.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <glm/gtc/type_ptr.hpp>
+
+#include <mdspan>
+#include <vector>
+
+#include <algorithm>
+#include <ranges>
+
+#include <cstdint>
+
+namespace RfGenExec = DisRegRep::RegionfieldGenerator::ExecutionPolicy;
+using DisRegRep::Container::PackedRegionfield, DisRegRep::Container::Regionfield, DisRegRep::Container::RegionfieldView,
+	DisRegRep::Core::View::Matrix::Slice2d, DisRegRep::Core::MdSpan::toExtent,
+	DisRegRep::RegionfieldGenerator::Uniform;
+
+using Catch::Matchers::SizeIs, Catch::Matchers::ContainsSubstring, Catch::Matchers::RangeEquals;
+
+using glm::make_vec2;
+
+using std::mdspan, std::vector;
+using std::ranges::equal,
+	std::views::cartesian_product, std::views::iota, std::views::join;
+
+SCENARIO("RegionfieldView is a non-owning view of a regionfield matrix", "[Container][RegionfieldView]") {
+
+	GIVEN("A regionfield") {
+		static constexpr Uniform Generator;
+
+		Regionfield rf;
+		rf.resize(make_vec2(GENERATE(take(3U, chunk(2U, random<std::uint_least8_t>(5U, 20U)))).data()));
+		rf.RegionCount = GENERATE(take(2U, random<Regionfield::ValueType>(1U, 10U)));
+		Generator(RfGenExec::MultiThreadingTrait, rf, {
+			.Seed = Catch::getSeed()
+		});
+
+		WHEN("It is viewed") {
+			const RegionfieldView rf_view = rf;
+
+			THEN("View has the same content as the regionfield") {
+				CHECK(rf_view.RegionCount == rf.RegionCount);
+				CHECK(rf_view.extent() == rf.extent());
+				CHECK_THAT(rf_view.range2d() | join, RangeEquals(rf.range2d() | join));
+			}
+
+			THEN("View is contiguous, and can be formed by plain spans") {
+				REQUIRE(rf_view.contiguous());
+				CHECK_THAT(rf_view.rangeContiguous2d() | join, RangeEquals(rf.range2d() | join));
+				CHECK(rf_view.visitRange2d([&rf](const auto rf_2d) { return equal(rf_2d | join, rf.range2d() | join); }));
+			}
+
+			AND_WHEN("View is transposed") {
+				const RegionfieldView rf_view_t = rf_view.transpose();
+
+				THEN("It is the same as a transposed regionfield without copying") {
+					const Regionfield rf_t = rf.transpose();
+					CHECK(rf_view_t.mdspan().data_handle() == rf.span().data());
+					CHECK(rf_view_t.extent() == rf_t.extent());
+					CHECK_THAT(rf_view_t.range2d() | join, RangeEquals(rf_t.range2d() | join));
+				}
+
+				THEN("It is not contiguous, and is visited by strided rows") {
+					CHECK_FALSE(rf_view_t.contiguous());
+					const Regionfield rf_t = rf.transpose();
+					CHECK(rf_view_t.visitRange2d([&rf_t](const auto rf_2d) { return equal(rf_2d | join, rf_t.range2d() | join); }));
+				}
+
+			}
+
+			AND_WHEN("View is cropped") {
+				const Regionfield::DimensionType extent = rf.extent(),
+					crop_offset = extent / 4U,
+					crop_extent = extent - crop_offset - extent / 3U;
+				const RegionfieldView rf_crop = rf_view.crop(crop_offset, crop_extent);
+
+				THEN("It views the sub-matrix of the regionfield") {
+					CHECK_THAT(rf_crop, SizeIs(crop_extent.x * crop_extent.y));
+					CHECK_THAT(rf_crop.range2d() | join,
+						RangeEquals(rf.range2d() | Slice2d(crop_offset, crop_extent) | join));
+					REQUIRE(rf_crop.contiguous());
+					CHECK_THAT(rf_crop.rangeContiguous2d() | join, RangeEquals(rf_crop.range2d() | join));
+				}
+
+				THEN("Crop cannot go out of bound") {
+					CHECK_THROWS_WITH(rf_view.crop(crop_offset, extent), ContainsSubstring("lessThanEqual"));
+				}
+
+			}
+
+		}
+
+		WHEN("It is copied to a blocked layout and viewed") {
+			const RegionfieldView::BlockedMappingType blocked_mapping(toExtent(rf.extent()));
+			auto blocked_rf = vector<Regionfield::ValueType>(blocked_mapping.required_span_size());
+			const auto blocked_rf_md = mdspan(blocked_rf.data(), blocked_mapping);
+			const auto rf_md = rf.mdspan();
+			for (const auto [x, y] : cartesian_product(iota(Regionfield::IndexType {}, rf_md.extent(0U)),
+				iota(Regionfield::IndexType {}, rf_md.extent(1U)))) {
+				blocked_rf_md[x, y] = rf_md[x, y];
+			}
+			const auto rf_view = RegionfieldView(RegionfieldView::BlockedMdSpanType(blocked_rf.data(), blocked_mapping), rf.RegionCount);
+
+			THEN("View has the same content as the regionfield, and is addressed by the blocked layout") {
+				CHECK_FALSE(rf_view.strided());
+				CHECK_FALSE(rf_view.contiguous());
+				CHECK(rf_view.extent() == rf.extent());
+				CHECK_THAT(rf_view.rangeBlocked2d() | join, RangeEquals(rf.range2d() | join));
+				CHECK(rf_view.visitRange2d([&rf](const auto rf_2d) { return equal(rf_2d | join, rf.range2d() | join); }));
+			}
+
+		}
+
+		WHEN("It is packed and viewed") {
+			PackedRegionfield packed_rf;
+			packed_rf.pack(rf);
+			const RegionfieldView rf_view = packed_rf;
+
+			THEN("View has the same content as the regionfield, and is decoded on access") {
+				CHECK_FALSE(rf_view.strided());
+				CHECK_FALSE(rf_view.contiguous());
+				CHECK(rf_view.RegionCount == rf.RegionCount);
+				CHECK(rf_view.extent() == rf.extent());
+				CHECK_THAT(rf_view, SizeIs(rf.size()));
+				CHECK(rf_view.visitRange2d([&rf](const auto rf_2d) { return equal(rf_2d | join, rf.range2d() | join); }));
+			}
+
+			THEN("View cannot be cropped or transposed") {
+				CHECK_THROWS_WITH(rf_view.crop(Regionfield::DimensionType(0U), rf.extent()), ContainsSubstring("strided"));
+				CHECK_THROWS_WITH(rf_view.transpose(), ContainsSubstring("strided"));
+			}
+
+		}
+
+	}
+
+}
\ No newline at end of file
@@ -20,6 +20,7 @@
 #include <functional>
 #include <ranges>
 
+#include <limits>
 #include <utility>
 
 #include <type_traits>
@@ -29,7 +30,7 @@
 namespace SpltKn = DisRegRep::Container::SplatKernel;
 namespace SpMatElem = DisRegRep::Container::SparseMatrixElement;
 namespace Type = DisRegRep::Core::Type;
-using SpltKn::Dense, SpltKn::Sparse;
+using SpltKn::Dense, SpltKn::Sparse, SpltKn::Fixed;
 
 using Catch::Matchers::SizeIs, Catch::Matchers::IsEmpty,
 	Catch::Matchers::RangeEquals;
@@ -38,7 +39,7 @@ using std::to_array, std::span,
 	std::apply;
 using std::ranges::all_of, std::ranges::copy, std::ranges::for_each,
 	std::bind_back, std::ranges::greater_equal, std::identity,
-	std::views::zip_transform, std::views::repeat, std::views::enumerate;
+	std::views::zip_transform, std::views::repeat, std::views::enumerate, std::views::iota, std::views::stride;
 using std::remove_const_t, std::is_same_v;
 
 namespace {
@@ -62,9 +63,9 @@ constexpr auto ExpectedDense = [] static consteval noexcept {
 constexpr auto ExpectedSparse = to_array<SpMatElem::Importance>({
 	{ 0, 42 },
 	{ 1, 131 },
-	{ 6, 82 },
 	{ 7, 63 },
 	{ 8, 134 },
+	{ 6, 82 },
 	{ 3, 48 },
 	{ 4, 10 },
 	{ 9, 50 }
@@ -106,7 +107,7 @@ void modifyKernel(Kernel& kernel, const ModifyType modify_type) {
 		for_each(DenseIncrement1 | SpMatElem::ToSparse, increment);
 		break;
 	case DenseArray:
-		if constexpr (is_same_v<Kernel, SpltKn::Dense>) {
+		if constexpr (!is_same_v<Kernel, SpltKn::Sparse>) {
 			kernel.increment(DenseIncrement0);
 			kernel.decrement(DenseDecrement0);
 			kernel.increment(DenseIncrement1);
@@ -125,9 +126,10 @@ void modifyKernel(Kernel& kernel, const ModifyType modify_type) {
 
 }
 
-TEMPLATE_TEST_CASE("A dense array of region importance where index corresponds to region identifier, or a sparse array of sparse matrix elements whose values are region importance", "[Container][SplatKernel]", Dense, Sparse) {
+TEMPLATE_TEST_CASE("A dense array of region importance where index corresponds to region identifier, or a sparse array of sparse matrix elements whose values are region importance", "[Container][SplatKernel]", Dense, Sparse, Fixed<16U>) {
 	using KernelType = TestType;
-	static constexpr bool IsDense = is_same_v<KernelType, Dense>;
+	//A fixed kernel behaves the same as a dense kernel.
+	static constexpr bool IsDense = !is_same_v<KernelType, Sparse>;
 
 	GIVEN("A default initialised splat kernel") {
 		KernelType kernel;
@@ -180,6 +182,46 @@ TEMPLATE_TEST_CASE("A dense array of region importance where index corresponds t
 				}
 			}
 
+			if constexpr (!IsDense) {
+				AND_WHEN("Kernel is converted to a mask in order") {
+					static_cast<void>(SpltKn::toMask(kernel, 1.0F, true));
+
+					THEN("Importance of regions are sorted by region identifier") {
+						CHECK_THAT(kernel.span(), RangeEquals(ExpectedDense | SpMatElem::ToSparse));
+					}
+
+					AND_WHEN("Kernel is modified after sorting") {
+						kernel.decrement(SpMatElem::Importance { .Identifier = 3U, .Value = 48U });
+						kernel.increment(SpMatElem::Importance { .Identifier = 2U, .Value = 5U });
+						kernel.increment(SpMatElem::Importance { .Identifier = 8U, .Value = 1U });
+
+						THEN("Offsets of regions remain consistent") {
+							CHECK_THAT(kernel.span(), SizeIs(ExpectedSparse.size()));
+							CHECK(all_of(kernel.span(), [](const auto importance) static {
+								const auto [region_id, value] = importance;
+								return value == (region_id == 8U ? ExpectedDense[region_id] + 1U
+									: region_id == 2U ? 5U : ExpectedDense[region_id]);
+							}));
+						}
+					}
+				}
+
+				AND_WHEN("Kernel is modified after a region is removed") {
+					kernel.decrement(SpMatElem::Importance { .Identifier = 3U, .Value = 48U });
+					kernel.increment(SpMatElem::Importance { .Identifier = 2U, .Value = 5U });
+					kernel.increment(SpMatElem::Importance { .Identifier = 8U, .Value = 1U });
+
+					THEN("Offsets of regions remain consistent") {
+						CHECK_THAT(kernel.span(), SizeIs(ExpectedSparse.size()));
+						CHECK(all_of(kernel.span(), [](const auto importance) static {
+							const auto [region_id, value] = importance;
+							return value == (region_id == 8U ? ExpectedDense[region_id] + 1U
+								: region_id == 2U ? 5U : ExpectedDense[region_id]);
+						}));
+					}
+				}
+			}
+
 			AND_WHEN("Kernel is cleared") {
 				//Do not take a span from a sparse kernel because memory is dynamically allocated.
 				const span old_kernel_memory = kernel.span();
@@ -209,4 +251,42 @@ TEMPLATE_TEST_CASE("A dense array of region importance where index corresponds t
 
 	}
 
+}
+
+SCENARIO("A sparse kernel only allocates memory for regions present in the kernel", "[Container][SplatKernel]") {
+
+	GIVEN("A sparse kernel resized to the largest region count") {
+		static constexpr auto LargeRegionCount = static_cast<Sparse::IndexType>(std::numeric_limits<Type::RegionIdentifier>::max() - 1U);
+		Sparse kernel;
+		kernel.resize(LargeRegionCount);
+
+		THEN("Memory does not scale with the region count") {
+			CHECK(kernel.sizeByte() < LargeRegionCount * sizeof(Sparse::OffsetType));
+		}
+
+		WHEN("Every region is added, and then every other region is removed") {
+			for (const auto region_id : iota(Sparse::IndexType {}, LargeRegionCount)) {
+				kernel.increment(SpMatElem::Importance { .Identifier = region_id, .Value = region_id + 1U });
+			}
+			for (const auto region_id : iota(Sparse::IndexType {}, LargeRegionCount) | stride(2U)) {
+				kernel.decrement(SpMatElem::Importance { .Identifier = region_id, .Value = region_id + 1U });
+			}
+
+			AND_WHEN("Remaining regions are incremented again") {
+				for (const auto region_id : iota(Sparse::IndexType { 1U }, LargeRegionCount) | stride(2U)) {
+					kernel.increment(region_id);
+				}
+
+				THEN("Every remaining region is found, and no removed region reappears") {
+					CHECK_THAT(kernel, SizeIs(LargeRegionCount / 2U));
+					CHECK(all_of(kernel.span(), [](const auto importance) static {
+						const auto [region_id, value] = importance;
+						return region_id % 2U == 1U && value == region_id + 2U;
+					}));
+				}
+			}
+		}
+
+	}
+
 }
\ No newline at end of file
@@ -4,6 +4,7 @@
 
 #include <DisRegRep/Core/View/Functional.hpp>
 #include <DisRegRep/Core/View/Matrix.hpp>
+#include <DisRegRep/Core/HalfPrecision.hpp>
 #include <DisRegRep/Core/Type.hpp>
 
 #include <DisRegRep-Test/StringMaker.hpp>
@@ -12,6 +13,7 @@
 #include <catch2/generators/catch_generators_random.hpp>
 
 #include <catch2/matchers/catch_matchers_container_properties.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
 #include <catch2/matchers/catch_matchers_range_equals.hpp>
 #include <catch2/matchers/catch_matchers_string.hpp>
 
@@ -21,6 +23,7 @@
 #include <glm/gtc/type_ptr.hpp>
 
 #include <span>
+#include <vector>
 
 #include <algorithm>
 #include <functional>
@@ -29,24 +32,29 @@
 #include <utility>
 
 #include <concepts>
+#include <limits>
 #include <type_traits>
 
 #include <cmath>
+#include <cstddef>
+#include <cstdint>
 
 namespace SpltCoef = DisRegRep::Container::SplattingCoefficient;
 namespace SpMatElem = DisRegRep::Container::SparseMatrixElement;
 namespace View = DisRegRep::Core::View;
 namespace Type = DisRegRep::Core::Type;
+namespace HalfPrec = DisRegRep::Core::HalfPrecision;
 
 using Catch::Matchers::SizeIs, Catch::Matchers::IsEmpty,
-	Catch::Matchers::RangeEquals, Catch::Matchers::ContainsSubstring;
+	Catch::Matchers::RangeEquals, Catch::Matchers::ContainsSubstring, Catch::Matchers::WithinAbs;
 
 using glm::make_vec3, glm::value_ptr;
 
-using std::span;
-using std::ranges::fold_left_first, std::ranges::copy, std::ranges::equal,
-	std::bind_back, std::multiplies, std::bit_or,
-	std::views::transform;
+using std::span, std::vector;
+using std::ranges::fold_left, std::ranges::fold_left_first, std::ranges::copy, std::ranges::equal,
+	std::ranges::sort, std::ranges::is_sorted, std::ranges::count_if, std::ranges::to,
+	std::bind_back, std::multiplies, std::plus, std::greater, std::bit_or,
+	std::views::iota, std::views::transform, std::views::reverse, std::views::zip;
 using std::unsigned_integral, std::is_unsigned_v;
 
 namespace {
@@ -160,4 +168,267 @@ TEMPLATE_PRODUCT_TEST_CASE("Matrix that stores region splatting coefficients can
 
 	}
 
+}
+
+TEMPLATE_TEST_CASE("Sparse matrix can be assembled from independently built segments", "[Container][SplattingCoefficient]",
+	Type::RegionImportance, Type::RegionMask) {
+	using MatrixType = SpltCoef::BasicSparse<TestType>;
+	using SegmentType = typename MatrixType::Segment;
+	using IndexType = typename MatrixType::IndexType;
+
+	GIVEN("A sparse matrix and some coefficients") {
+		const auto dim_vec = generateDimension<IndexType>();
+		const auto dim = make_vec3(dim_vec.data());
+		MatrixType expected, assembled;
+		expected.resize(dim);
+		assembled.resize(dim);
+
+		const auto coefficient = GENERATE_REF(take(1U, chunk(*fold_left_first(dim_vec, multiplies {}), map([](const auto coef) static {
+			return static_cast<TestType>(std::max(coef, 0));
+		}, random(-2, 3)))));
+		const auto input = coefficient | View::Matrix::NewAxisLeft(dim.z);
+		copy(input, expected.range().begin());
+
+		WHEN("Each row is filled in to a segment in reverse order, and segments are assembled") {
+			vector<SegmentType> segment(dim.x);
+			for (const auto [current_segment, row] : zip(segment, input | View::Matrix::NewAxisLeft(dim.y)) | reverse) {
+				current_segment.resize(dim.y);
+				copy(row, current_segment.range().begin());
+			}
+			assembled.assemble(segment);
+
+			THEN("Assembled matrix is the same as the one filled in sequentially") {
+				CHECK(assembled.size() == expected.size());
+				CHECK_THAT(assembled.range() | View::Functional::Dereference,
+					RangeEquals(expected.range() | View::Functional::Dereference, equal));
+			}
+
+		}
+
+		WHEN("Segments do not cover the whole matrix") {
+			vector<SegmentType> segment(1U);
+			segment.front().resize(dim.y);
+
+			THEN("Assembly fails") {
+				CHECK_THROWS_WITH(assembled.assemble(segment), ContainsSubstring("required_span_size"));
+			}
+
+		}
+
+	}
+
+}
+
+TEMPLATE_TEST_CASE("Half precision mask matrix converts single precision masks on the fly", "[Container][SplattingCoefficient]",
+	HalfPrec::Float16, HalfPrec::BFloat16) {
+	using HalfType = TestType;
+	using IndexType = SpltCoef::Type::IndexType;
+
+	//Half of the unit in the last place of a value of exponent zero.
+	static constexpr float Tolerance = HalfType::Encoding == HalfPrec::Format::Binary16 ? 0x1p-11F : 0x1p-8F;
+	static constexpr auto near = [](const float half, const float single) static { return WithinAbs(single, Tolerance).match(half); };
+
+	GIVEN("Half precision matrices, single precision matrices and some coefficients") {
+		const auto dim_vec = generateDimension<IndexType>();
+		const auto dim = make_vec3(dim_vec.data());
+		SpltCoef::BasicDense<HalfType> dense_half;
+		SpltCoef::BasicSparse<HalfType> sparse_half;
+		SpltCoef::DenseMask dense;
+		SpltCoef::SparseMask sparse;
+		dense_half.resize(dim);
+		sparse_half.resize(dim);
+		dense.resize(dim);
+		sparse.resize(dim);
+
+		THEN("Dense matrix takes half of the memory") {
+			REQUIRE(dense_half.sizeByte() * 2U == dense.sizeByte());
+		}
+
+		const auto coefficient = GENERATE_REF(take(1U, chunk(*fold_left_first(dim_vec, multiplies {}), map([](const auto coef) static {
+			return std::max(coef, 0.0F);
+		}, random(-0.5F, 1.0F)))));
+		const auto input = coefficient | View::Matrix::NewAxisLeft(dim.z);
+
+		WHEN("Matrices are filled in with the same single precision coefficients") {
+			copy(input, dense_half.range().begin());
+			copy(input, dense.range().begin());
+			copy(input, sparse.range().begin());
+			//Sparse matrix elements of single precision are converted when appended.
+			copy(sparse.range() | View::Functional::Dereference, sparse_half.range().begin());
+
+			THEN("Half precision matrices hold the nearest values") {
+				CHECK_THAT(dense_half.range() | View::Functional::Dereference,
+					RangeEquals(input, [](const auto half, const auto single) static { return equal(half, single, near); }));
+
+				REQUIRE(sparse_half.size() == sparse.size());
+				CHECK_THAT(sparse_half.range() | View::Functional::Dereference,
+					RangeEquals(sparse.range() | View::Functional::Dereference, [](const auto half, const auto single) static {
+						return equal(half, single, [](const auto half_element, const auto single_element) static {
+							return half_element.Identifier == single_element.Identifier && near(half_element.Value, single_element.Value);
+						});
+					}));
+			}
+
+			THEN("Half precision values are normalised in single precision") {
+				for (const auto [half, single] : zip(sparse_half.range(), sparse.range())) {
+					CHECK_THAT(*half | SpMatElem::Normalise(2.0F),
+						RangeEquals(*single | SpMatElem::Normalise(2.0F), [](const auto half_element, const auto single_element) static {
+							return half_element.Identifier == single_element.Identifier && near(half_element.Value, single_element.Value);
+						}));
+				}
+			}
+
+		}
+
+	}
+
+}
+
+TEMPLATE_TEST_CASE("Compact sparse matrix stores the same coefficients as a sparse matrix in less memory", "[Container][SplattingCoefficient]",
+	SpltCoef::CompactSparseMask, SpltCoef::QuantisedSparseMask) {
+	using MatrixType = TestType;
+	using IndexType = typename MatrixType::IndexType;
+	using StorageType = typename MatrixType::StorageType;
+
+	static constexpr float Tolerance = MatrixType::IsQuantised ? 1.0F / std::numeric_limits<StorageType>::max() : 0.0F;
+
+	GIVEN("A compact sparse matrix, a sparse matrix and some coefficients") {
+		const auto dim_vec = generateDimension<IndexType>();
+		const auto dim = make_vec3(dim_vec.data());
+		MatrixType compact;
+		SpltCoef::SparseMask sparse;
+		compact.resize(dim);
+		sparse.resize(dim);
+
+		const auto coefficient = GENERATE_REF(take(1U, chunk(*fold_left_first(dim_vec, multiplies {}), map([](const auto coef) static {
+			return std::max(coef, 0.0F);
+		}, random(-0.5F, 1.0F)))));
+		const auto input = coefficient | View::Matrix::NewAxisLeft(dim.z);
+
+		WHEN("Both matrices are filled in with the coefficients") {
+			copy(input, compact.range().begin());
+			copy(input, sparse.range().begin());
+
+			THEN("Both matrices hold the same coefficients") {
+				REQUIRE(compact.size() == sparse.size());
+				CHECK_THAT(compact.range() | View::Functional::Dereference,
+					RangeEquals(sparse.range() | View::Functional::Dereference, [](const auto& compact_element, const auto& sparse_element) {
+						return equal(compact_element, sparse_element, [](const auto compact_value, const auto sparse_value) static {
+							return compact_value.Identifier == sparse_value.Identifier
+								&& WithinAbs(sparse_value.Value, Tolerance).match(compact_value.Value);
+						});
+					}));
+			}
+
+			THEN("Identifiers and values are stored without padding") {
+				CHECK(compact.sizeByte() - compact.size() * (sizeof(Type::RegionIdentifier) + sizeof(StorageType))
+					== sparse.sizeByte() - sparse.size() * sizeof(SpMatElem::Mask));
+				CHECK_THAT(compact.value(), SizeIs(compact.size()));
+			}
+
+			AND_WHEN("Values of each element are written in reverse order and sorted") {
+				MatrixType reversed;
+				reversed.resize(dim);
+				copy(input | transform([](const auto element) static { return element | SpMatElem::ToSparse | to<vector>() | reverse; }),
+					reversed.range().begin());
+				reversed.sort();
+
+				THEN("Matrix is the same as the one filled in sorted") {
+					CHECK(reversed.isSorted());
+					CHECK_THAT(reversed.range() | View::Functional::Dereference,
+						RangeEquals(compact.range() | View::Functional::Dereference, equal));
+				}
+
+			}
+
+		}
+
+	}
+
+}
+
+SCENARIO("Planar region mask matrix stores coefficients of each region contiguously", "[Container][SplattingCoefficient]") {
+	using MatrixType = SpltCoef::PlanarMask;
+	using IndexType = MatrixType::IndexType;
+
+	GIVEN("A planar matrix and some coefficients") {
+		const auto dim_vec = generateDimension<IndexType>();
+		const auto dim = make_vec3(dim_vec.data());
+		MatrixType matrix;
+		matrix.resize(dim);
+
+		THEN("Memory usage is the same as a dense matrix") {
+			REQUIRE_THAT(matrix, SizeIs(dim.x * dim.y * dim.z));
+			REQUIRE(matrix.sizeByte() == dim.x * dim.y * dim.z * sizeof(Type::RegionMask));
+		}
+
+		const auto coefficient = GENERATE_REF(take(1U, chunk(*fold_left_first(dim_vec, multiplies {}), random(0.0F, 1.0F))));
+		const auto input = coefficient | View::Matrix::NewAxisLeft(dim.z);
+
+		WHEN("Matrix is filled in with the coefficients") {
+			const auto output = matrix.range();
+			copy(input, output.begin());
+
+			THEN("Coefficients read element by element equal the input coefficients") {
+				CHECK_THAT(output | View::Functional::Dereference, RangeEquals(input, equal));
+			}
+
+			THEN("Each plane holds the coefficients of one region of every element") {
+				const auto mat = std::as_const(matrix).mdspan();
+				for (const auto region : iota(IndexType {}, dim.z)) {
+					const auto plane = std::as_const(matrix).plane(region);
+					REQUIRE_THAT(plane, SizeIs(dim.x * dim.y));
+					CHECK_THAT(plane, RangeEquals(input | transform([region](const auto value) { return value[region]; })));
+					CHECK(&mat[IndexType {}, IndexType {}, region] == plane.data());
+				}
+			}
+
+		}
+
+	}
+
+}
+
+TEMPLATE_TEST_CASE_SIG("Top-K region mask matrix only keeps the greatest coefficients of each element", "[Container][SplattingCoefficient]",
+	((std::uint_fast8_t K), K), 1U, 2U, 3U, 4U) {
+	using MatrixType = SpltCoef::TopKMask<K>;
+	using IndexType = typename MatrixType::IndexType;
+	using ValueType = typename MatrixType::ValueType;
+
+	GIVEN("A top-K matrix and some coefficients") {
+		const auto dim_vec = generateDimension<IndexType>();
+		const auto dim = make_vec3(dim_vec.data());
+		MatrixType matrix;
+		matrix.resize(dim);
+
+		THEN("Memory usage only depends on width, height and K") {
+			REQUIRE(matrix.sizeByte() == dim.x * dim.y * K * (sizeof(Type::RegionIdentifier) + sizeof(ValueType)));
+		}
+
+		const auto coefficient = GENERATE_REF(take(1U, chunk(*fold_left_first(dim_vec, multiplies {}), random(0.0F, 10.0F))));
+		const auto input = coefficient | View::Matrix::NewAxisLeft(dim.z);
+
+		WHEN("Matrix is filled in with the coefficients in reverse order") {
+			const auto output = matrix.range();
+			copy(input | reverse, (output | reverse).begin());
+
+			THEN("Each element keeps the K greatest coefficients, sorted by region identifier and summed to one") {
+				for (const auto [in, out] : zip(input, output | View::Functional::Dereference)) {
+					auto sorted_in = in | to<vector>();
+					sort(sorted_in, greater {});
+					const auto expected_size = std::ranges::min<std::size_t>(K, count_if(in, bind_back(greater {}, 0.0F)));
+
+					REQUIRE_THAT(out, SizeIs(expected_size));
+					CHECK(is_sorted(out, {}, &SpMatElem::Mask::Identifier));
+					CHECK_THAT(fold_left(out | transform(&SpMatElem::Mask::Value), 0.0F, plus {}), WithinAbs(1.0F, 1e-5F));
+					for (const auto [identifier, value] : out) {
+						CHECK(in[identifier] >= sorted_in[expected_size - 1U]);
+					}
+				}
+			}
+
+		}
+
+	}
+
 }
\ No newline at end of file
@@ -0,0 +1,93 @@
+#include <DisRegRep/Core/HalfPrecision.hpp>
+
+#include <catch2/generators/catch_generators_adapters.hpp>
+#include <catch2/generators/catch_generators_random.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <limits>
+
+#include <cmath>
+#include <cstdint>
+
+namespace HalfPrec = DisRegRep::Core::HalfPrecision;
+using HalfPrec::Float16, HalfPrec::BFloat16;
+
+using Catch::Matchers::WithinRel;
+
+using std::numeric_limits;
+
+SCENARIO("IEEE half precision converts from and to single precision with correct rounding", "[Core][HalfPrecision]") {
+
+	GIVEN("Some values exactly representable in half precision") {
+
+		THEN("They are encoded to the known bit patterns") {
+			CHECK(Float16(1.0F).bit() == 0x3C00U);
+			CHECK(Float16(0.5F).bit() == 0x3800U);
+			CHECK(Float16(-2.0F).bit() == 0xC000U);
+			CHECK(Float16(65504.0F).bit() == 0x7BFFU);
+			CHECK(Float16(0x1p-14F).bit() == 0x0400U);
+			CHECK(Float16(0x1p-24F).bit() == 0x0001U);
+		}
+
+		THEN("They are decoded without error") {
+			CHECK(static_cast<float>(Float16::fromBit(0x3555U)) == 0x1.554p-2F);
+			CHECK(static_cast<float>(Float16::fromBit(0x03FFU)) == 0x1.ff8p-15F);
+		}
+
+	}
+
+	GIVEN("Some values not representable in half precision") {
+
+		THEN("They are rounded to nearest, with ties to even") {
+			CHECK(Float16(1.0F + 0x1p-11F).bit() == 0x3C00U);
+			CHECK(Float16(1.0F + 0x3p-11F).bit() == 0x3C02U);
+			CHECK(Float16(1.0F / 3.0F).bit() == 0x3555U);
+			CHECK(Float16(0x1p-25F).bit() == 0x0000U);
+			CHECK(Float16(0x1.8p-25F).bit() == 0x0001U);
+		}
+
+		THEN("Out of range values become infinity or zero") {
+			CHECK(Float16(65520.0F).bit() == 0x7C00U);
+			CHECK(Float16(numeric_limits<float>::infinity()).bit() == 0x7C00U);
+			CHECK(Float16(0x1p-30F).bit() == 0x0000U);
+			CHECK(std::isnan(static_cast<float>(Float16(numeric_limits<float>::quiet_NaN()))));
+		}
+
+	}
+
+}
+
+TEMPLATE_TEST_CASE("Half precision round trips any value within the unit interval with a bounded relative error", "[Core][HalfPrecision]",
+	Float16, BFloat16) {
+	using HalfType = TestType;
+	//Half of the unit in the last place of a value of exponent zero.
+	static constexpr float Epsilon = HalfType::Encoding == HalfPrec::Format::Binary16 ? 0x1p-11F : 0x1p-8F;
+
+	GIVEN("A single precision value within the normal range of the half precision") {
+		const float value = GENERATE(take(10U, random(0x1p-14F, 1.0F)));
+
+		WHEN("It is converted to half precision") {
+			const HalfType half = value;
+
+			THEN("Converting it back gives the nearest value") {
+				CHECK_THAT(static_cast<float>(half), WithinRel(value, Epsilon));
+				CHECK(static_cast<float>(HalfType(static_cast<float>(half))) == static_cast<float>(half));
+			}
+
+		}
+
+	}
+
+	GIVEN("Some values in the unit interval") {
+
+		THEN("Zero and one are exact") {
+			CHECK(static_cast<float>(HalfType(0.0F)) == 0.0F);
+			CHECK(static_cast<float>(HalfType(1.0F)) == 1.0F);
+			CHECK(HalfType {} == 0.0F);
+		}
+
+	}
+
+}
\ No newline at end of file
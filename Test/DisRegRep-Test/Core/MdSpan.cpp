@@ -0,0 +1,75 @@
+#include <DisRegRep/Core/MdSpan.hpp>
+
+#include <catch2/generators/catch_generators_adapters.hpp>
+#include <catch2/generators/catch_generators_random.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <mdspan>
+#include <vector>
+
+#include <algorithm>
+#include <ranges>
+
+#include <cstdint>
+
+namespace MdSpan = DisRegRep::Core::MdSpan;
+
+using std::dextents, std::vector;
+using std::ranges::all_of,
+	std::views::cartesian_product, std::views::iota;
+
+namespace {
+
+using IndexType = std::uint_fast32_t;
+
+}
+
+TEMPLATE_TEST_CASE_SIG("LayoutBlocked maps a matrix into contiguous square blocks", "[Core][MdSpan]",
+	((IndexType BlockSize), BlockSize), 4U, 16U) {
+	using Layout = MdSpan::LayoutBlocked<BlockSize>;
+
+	GIVEN("A blocked mapping of a 2D matrix") {
+		const IndexType width = GENERATE(take(2U, random<IndexType>(1U, 40U))),
+			height = GENERATE(take(2U, random<IndexType>(1U, 40U)));
+		const typename Layout::template mapping<dextents<IndexType, 2U>> mapping(dextents<IndexType, 2U>(width, height));
+
+		THEN("Every element is mapped to a unique offset within the span") {
+			vector<IndexType> hit(mapping.required_span_size());
+			for (const auto [x, y] : cartesian_product(iota(IndexType {}, width), iota(IndexType {}, height))) {
+				const IndexType offset = mapping(x, y);
+				REQUIRE(offset < hit.size());
+				hit[offset]++;
+			}
+			CHECK(all_of(hit, [](const auto count) static { return count <= 1U; }));
+		}
+
+		THEN("Elements within a block are contiguous") {
+			CHECK(mapping(1U % width, 0U) - mapping(0U, 0U) == (width > 1U ? BlockSize : 0U));
+			CHECK(mapping(0U, 1U % height) - mapping(0U, 0U) == (height > 1U ? 1U : 0U));
+		}
+
+		THEN("Mapping is exhaustive only if extents are multiples of block size") {
+			CHECK(mapping.is_exhaustive() == (width % BlockSize == 0U && height % BlockSize == 0U));
+		}
+
+	}
+
+	GIVEN("A blocked mapping of a 3D matrix") {
+		const IndexType region_count = GENERATE(take(2U, random<IndexType>(1U, 8U)));
+		const typename Layout::template mapping<dextents<IndexType, 3U>> mapping(
+			dextents<IndexType, 3U>(BlockSize + 1U, 3U, region_count));
+
+		THEN("The innermost rank has a stride of one") {
+			for (const auto [x, y, z] : cartesian_product(
+				iota(IndexType {}, BlockSize + 1U),
+				iota(IndexType {}, IndexType { 3U }),
+				iota(IndexType {}, region_count)
+			)) {
+				REQUIRE(mapping(x, y, z) == mapping(x, y, IndexType {}) + z);
+			}
+		}
+
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,71 @@
+#include <DisRegRep/Core/Random.hpp>
+#include <DisRegRep/Core/XXHash.hpp>
+
+#include <catch2/generators/catch_generators_adapters.hpp>
+#include <catch2/generators/catch_generators_random.hpp>
+#include <catch2/matchers/catch_matchers_range_equals.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+
+#include <algorithm>
+#include <ranges>
+
+#include <cstdint>
+
+namespace Random = DisRegRep::Core::Random;
+namespace XXHash = DisRegRep::Core::XXHash;
+
+using Catch::Matchers::RangeEquals;
+
+using std::array;
+using std::ranges::generate;
+
+namespace {
+
+using ObjectType = std::uint32_t;
+
+constexpr auto ApplicationSecret = XXHash::makeApplicationSecret("a4 1b 6e 0c 93 5f d8 27 c1 7e 44 b9 02 f6 3d 8a 5b e0 19 c7 72 0d a6 3e 98 f1 2c 54 bd 07 e3 61 86 4a ff 10 c5 39 7b d2 0e 95 63 a8 2f ea 51 8c 34 c0 6d 17 b3 f8 49 0a 9e 25 d7 70 1c 83 e6 3b 58 cd 04 af 92 61 2d f4 0b 87 5e 16 c9 30 7a e2");
+
+//Generate a fixed number of random numbers from an engine created with a key and objects.
+template<Random::IsEnginePolicy E>
+[[nodiscard]] array<std::uint64_t, 16U> generateSequence(const typename E::KeyType& key, const ObjectType x, const ObjectType y) {
+	array<std::uint64_t, 16U> sequence;
+	generate(sequence, [rng = E::makeEngine(key, x, y)] mutable { return rng(); });
+	return sequence;
+}
+
+}
+
+TEMPLATE_TEST_CASE("Counter-based random engines generate deterministic sequences keyed by a secret and objects", "[Core][Random]",
+	Random::XXH3, Random::SplitMix, Random::Squares) {
+	using EnginePolicy = TestType;
+
+	GIVEN("A key derived from a secret") {
+		const auto seed = GENERATE(take(2U, random<XXHash::SeedType>(0U, 0xFFFFU)));
+		const typename EnginePolicy::KeyType key = EnginePolicy::makeKey(XXHash::generateSecret(ApplicationSecret, seed));
+		const ObjectType x = GENERATE(take(3U, random<ObjectType>(0U, 0xFFFFFFU)));
+		const ObjectType y = GENERATE(take(2U, random<ObjectType>(0U, 0xFFFFFFU)));
+
+		WHEN("Engines are created with the same objects") {
+			const auto sequence = generateSequence<EnginePolicy>(key, x, y);
+
+			THEN("They generate the same sequence") {
+				CHECK_THAT(generateSequence<EnginePolicy>(key, x, y), RangeEquals(sequence));
+			}
+
+			AND_WHEN("Another engine is created with different objects") {
+				const auto another_sequence = generateSequence<EnginePolicy>(key, x + 1U, y);
+
+				THEN("It generates a different sequence") {
+					CHECK_THAT(another_sequence, !RangeEquals(sequence));
+				}
+
+			}
+
+		}
+
+	}
+
+}
\ No newline at end of file
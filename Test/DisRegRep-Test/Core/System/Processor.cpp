@@ -0,0 +1,37 @@
+#include <DisRegRep/Core/System/Processor.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <string>
+
+#include <algorithm>
+
+namespace Processor = DisRegRep::Core::System::Processor;
+
+using std::string;
+using std::ranges::contains;
+
+SCENARIO("Query the model name of the processor", "[Core][System][Processor]") {
+
+	GIVEN("The model name of the processor") {
+		const string model = Processor::getModelName();
+
+		THEN("Model name is not empty and has no surrounding space") {
+			REQUIRE_FALSE(model.empty());
+			CHECK(model.front() != ' ');
+			CHECK(model.back() != ' ');
+		}
+
+		THEN("Model name contains no control character, so it can be used as a field of a line of text") {
+			CHECK_FALSE(contains(model, '\0'));
+			CHECK_FALSE(contains(model, '\t'));
+			CHECK_FALSE(contains(model, '\n'));
+		}
+
+		THEN("The same model name is returned every time") {
+			CHECK(Processor::getModelName() == model);
+		}
+
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,101 @@
+#include <DisRegRep/Image/Serialisation/Container/SplattingCoefficient.hpp>
+#include <DisRegRep/Image/Serialisation/Protocol.hpp>
+#include <DisRegRep/Image/Tiff.hpp>
+
+#include <DisRegRep/Container/SplattingCoefficient.hpp>
+#include <DisRegRep/Splatting/Pyramid.hpp>
+
+#include <catch2/generators/catch_generators.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <glm/fwd.hpp>
+#include <glm/vec3.hpp>
+
+#include <tiff.h>
+#include <tiffio.h>
+
+#include <string>
+#include <vector>
+
+#include <algorithm>
+#include <filesystem>
+#include <ranges>
+
+#include <cstdint>
+
+namespace Ptc = DisRegRep::Image::Serialisation::Protocol;
+using DisRegRep::Image::Tiff,
+	DisRegRep::Container::SplattingCoefficient::DenseMask,
+	DisRegRep::Splatting::Pyramid;
+
+using glm::u32vec3;
+
+using std::string, std::vector;
+using std::ranges::for_each, std::ranges::fill,
+	std::views::zip;
+
+namespace {
+
+using DenseMaskProtocol = Ptc::Implementation<DenseMask>;
+
+//Image width and length are written in the reversed order of the matrix extent.
+[[nodiscard]] u32vec3 imageExtent(const DenseMask& mask) {
+	const DenseMask::Dimension3Type extent = mask.extent();
+	return u32vec3(extent.y, extent.x, extent.z);
+}
+
+}
+
+SCENARIO("Write reduced levels of a dense mask as SubIFDs of its base level", "[Image][Serialisation][Container][SplattingCoefficient]") {
+
+	//Application tags can only be defined once in a programme.
+	[[maybe_unused]] static const bool Initialised = [] static {
+		DenseMaskProtocol::initialise();
+		return true;
+	}();
+
+	GIVEN("A dense mask and its reduced levels") {
+		DenseMask base;
+		base.resize(GENERATE(values<DenseMask::Dimension3Type>({ { 6U, 5U, 3U }, { 1U, 9U, 2U } })));
+		for_each(base.range(), [](const auto proxy) static { fill(*proxy, 1.0F / 3.0F); });
+
+		Pyramid pyramid;
+		pyramid(base);
+		const auto level = pyramid.level();
+		REQUIRE_FALSE(level.empty());
+
+		WHEN("They are written to an image") {
+			const string filename = (std::filesystem::temp_directory_path() / "DisRegRep-Test-DenseMaskPyramid.tif").string();
+			{
+				const auto tif = Tiff(filename, "w");
+				DenseMaskProtocol::write(tif, base, level, 7U, {
+					.Compression = Ptc::CompressionScheme::None {}
+				});
+			}
+			const auto tif = Tiff(filename, "r");
+
+			THEN("The base level has one SubIFD for every reduced level, each of which has the extent of that level") {
+				CHECK(tif.getImageExtent() == imageExtent(base));
+
+				const auto sub_ifd = tif.getField<std::uint16_t, toff_t*>(TIFFTAG_SUBIFD);
+				REQUIRE(sub_ifd);
+				const auto [sub_count, sub_offset_data] = *sub_ifd;
+				REQUIRE(sub_count == level.size());
+				//Offsets are owned by the current directory, which is about to be changed.
+				const auto sub_offset = vector(sub_offset_data, sub_offset_data + sub_count);
+
+				for_each(zip(sub_offset, level), [&tif](const auto sub) {
+					const auto& [offset, reduced] = sub;
+					REQUIRE(TIFFSetSubDirectory(*tif, offset) == 1);
+					CHECK(tif.getField<std::uint32_t>(TIFFTAG_SUBFILETYPE) == FILETYPE_REDUCEDIMAGE);
+					CHECK(tif.getImageExtent() == imageExtent(reduced));
+				});
+			}
+
+			static_cast<void>(std::filesystem::remove(filename));
+		}
+
+	}
+
+}
\ No newline at end of file
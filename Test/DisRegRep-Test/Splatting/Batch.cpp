@@ -0,0 +1,123 @@
+#include <DisRegRep/Splatting/OccupancyConvolution/Full/Fast.hpp>
+#include <DisRegRep/Splatting/Batch.hpp>
+#include <DisRegRep/Splatting/Container.hpp>
+
+#include <DisRegRep/Container/Regionfield.hpp>
+#include <DisRegRep/Container/SplattingCoefficient.hpp>
+
+#include <DisRegRep/Core/View/Functional.hpp>
+#include <DisRegRep/Core/ThreadPool.hpp>
+
+#include <DisRegRep/RegionfieldGenerator/ExecutionPolicy.hpp>
+#include <DisRegRep/RegionfieldGenerator/Uniform.hpp>
+
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/matchers/catch_matchers_range_equals.hpp>
+
+#include <catch2/catch_get_random_seed.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <vector>
+
+#include <any>
+#include <optional>
+
+#include <algorithm>
+#include <ranges>
+
+namespace RfGenExec = DisRegRep::RegionfieldGenerator::ExecutionPolicy;
+namespace Splt = DisRegRep::Splatting;
+namespace View = DisRegRep::Core::View;
+using DisRegRep::Splatting::Batch, DisRegRep::Splatting::OccupancyConvolution::Full::Fast,
+	DisRegRep::Container::Regionfield, DisRegRep::Container::SplattingCoefficient::DenseMask,
+	DisRegRep::Core::ThreadPool,
+	DisRegRep::RegionfieldGenerator::Uniform;
+
+using Catch::Matchers::RangeEquals;
+
+using std::vector,
+	std::any, std::optional;
+using std::ranges::for_each,
+	std::views::iota, std::views::join, std::views::zip;
+
+namespace {
+
+//Region masks cannot be copy-assigned, so they are copied element by element.
+void copyMask(DenseMask& target, const DenseMask& source) {
+	target.resize(source.extent());
+	for_each(zip(target.range(), source.range()), [](const auto proxy) static {
+		const auto [target_proxy, source_proxy] = proxy;
+		target_proxy = *source_proxy;
+	});
+}
+
+}
+
+SCENARIO("Invoke a splatting over a batch of regionfields with reused scratch memory", "[Splatting][Batch]") {
+
+	GIVEN("A splatting and a batch of random regionfields") {
+		Fast splatting;
+		splatting.Radius = 3U;
+		const Splt::Base::InvokeInfo invoke_info {
+			.Offset = splatting.minimumOffset(),
+			.Extent = Splt::Base::DimensionType(12U, 9U)
+		};
+
+		auto regionfield = vector<Regionfield>(5U);
+		for (const auto [index, rf] : zip(iota(0U), regionfield)) {
+			rf.RegionCount = 6U;
+			rf.resize(splatting.minimumRegionfieldDimension(invoke_info));
+			static constexpr Uniform Generator;
+			Generator(RfGenExec::SingleThreadingTrait, rf, {
+				.Seed = Catch::getSeed() + index
+			});
+		}
+
+		const auto expected = [&] {
+			//Every regionfield is splatted with its own scratch memory.
+			auto mask = vector<DenseMask>(regionfield.size());
+			for (const auto [rf, m] : zip(regionfield, mask)) {
+				any memory;
+				copyMask(m, splatting(Splt::Container::DenseKernelDenseOutputTrait, invoke_info, rf, memory));
+			}
+			return mask;
+		}();
+
+		AND_GIVEN("A batch executor") {
+			optional<ThreadPool> thread_pool;
+			const bool parallel = GENERATE(false, true);
+			auto executor = [&thread_pool, parallel] {
+				if (!parallel) {
+					return Batch();
+				}
+				return Batch(thread_pool.emplace(2U));
+			}();
+
+			WHEN("The same executor is invoked with the batch more than once") {
+				auto actual = vector<DenseMask>(regionfield.size());
+				auto sink = [&actual](const Batch::SizeType index, const DenseMask& mask) -> void { copyMask(actual[index], mask); };
+
+				executor(splatting, Splt::Container::DenseKernelDenseOutputTrait, invoke_info, regionfield, sink);
+				const Batch::SizeType size_first = executor.sizeByte(splatting);
+				executor(splatting, Splt::Container::DenseKernelDenseOutputTrait, invoke_info, regionfield, sink);
+
+				THEN("Scratch memory is allocated once and reused by the subsequent batch") {
+					CHECK(size_first > 0U);
+					CHECK(executor.sizeByte(splatting) == size_first);
+				}
+
+				THEN("Region masks are the same as those computed by invoking the splatting on each regionfield") {
+					for_each(zip(actual, expected), [](const auto mask) static {
+						const auto& [actual_mask, expected_mask] = mask;
+						CHECK_THAT(actual_mask.range() | View::Functional::Dereference | join,
+							RangeEquals(expected_mask.range() | View::Functional::Dereference | join));
+					});
+				}
+
+			}
+
+		}
+
+	}
+
+}
\ No newline at end of file
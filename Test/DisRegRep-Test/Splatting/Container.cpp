@@ -0,0 +1,43 @@
+#include <DisRegRep/Splatting/Container.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <tuple>
+
+#include <cstddef>
+
+namespace Splt = DisRegRep::Splatting;
+using Splt::Container::Implementation;
+
+using std::array, std::tuple;
+
+SCENARIO("Select a dense output container trait by region count", "[Splatting][Container]") {
+
+	GIVEN("Regionfields of different region counts") {
+		static constexpr auto Expected = array {
+			tuple<std::size_t, Implementation> { 1U, Implementation::Fixed4 },
+			tuple<std::size_t, Implementation> { 4U, Implementation::Fixed4 },
+			tuple<std::size_t, Implementation> { 5U, Implementation::Fixed8 },
+			tuple<std::size_t, Implementation> { 8U, Implementation::Fixed8 },
+			tuple<std::size_t, Implementation> { 9U, Implementation::Fixed16 },
+			tuple<std::size_t, Implementation> { 16U, Implementation::Fixed16 },
+			tuple<std::size_t, Implementation> { 17U, Implementation::Dense },
+			tuple<std::size_t, Implementation> { 100U, Implementation::Dense }
+		};
+
+		THEN("The smallest fixed kernel that holds every region is selected") {
+			for (const auto [region_count, kernel] : Expected) {
+				CAPTURE(region_count);
+				const auto [selected_kernel, selected_output] =
+					Splt::Container::dispatchDenseOutput(region_count, []<typename Trait>(Trait) static {
+						return tuple(Trait::KernelImplementation, Trait::OutputImplementation);
+					});
+				CHECK(selected_kernel == kernel);
+				CHECK(selected_output == Implementation::Dense);
+			}
+		}
+
+	}
+
+}
\ No newline at end of file
@@ -1,6 +1,8 @@
 #include <DisRegRep-Test/Splatting/GroundTruth.hpp>
 
+#include <DisRegRep/Container/PackedRegionfield.hpp>
 #include <DisRegRep/Container/Regionfield.hpp>
+#include <DisRegRep/Container/RegionfieldView.hpp>
 #include <DisRegRep/Container/SparseMatrixElement.hpp>
 #include <DisRegRep/Container/SplattingCoefficient.hpp>
 
@@ -24,6 +26,8 @@
 #include <glm/gtc/type_ptr.hpp>
 
 #include <array>
+#include <mdspan>
+#include <vector>
 
 #include <any>
 #include <tuple>
@@ -36,6 +40,9 @@
 #include <utility>
 
 #include <concepts>
+#include <limits>
+
+#include <type_traits>
 
 #include <cstdint>
 
@@ -45,20 +52,20 @@ namespace SpltCoef = DisRegRep::Container::SplattingCoefficient;
 namespace View = DisRegRep::Core::View;
 namespace Type = DisRegRep::Core::Type;
 namespace Splt = DisRegRep::Splatting;
-using DisRegRep::Container::Regionfield,
-	DisRegRep::Core::MdSpan::reverse;
+using DisRegRep::Container::PackedRegionfield, DisRegRep::Container::Regionfield, DisRegRep::Container::RegionfieldView,
+	DisRegRep::Core::MdSpan::reverse, DisRegRep::Core::MdSpan::toExtent;
 
 using Catch::Matchers::WithinAbs, Catch::Matchers::RangeEquals, Catch::Matchers::ContainsSubstring;
 
 using glm::make_vec2;
 
-using std::array, std::to_array;
+using std::array, std::to_array, std::mdspan, std::vector;
 using std::any,
 	std::tie, std::apply, std::tuple_size_v;
 using std::ranges::copy, std::ranges::all_of,
 	std::bind_front, std::bind_back, std::identity,
 	std::indirect_binary_predicate,
-	std::views::transform, std::views::join, std::views::zip_transform,
+	std::views::cartesian_product, std::views::iota, std::views::transform, std::views::join, std::views::zip_transform,
 	std::ranges::input_range, std::ranges::viewable_range,
 	std::ranges::range_value_t, std::ranges::range_const_reference_t, std::ranges::const_iterator_t;
 using std::floating_point;
@@ -141,14 +148,27 @@ void compare(const Matrix& matrix, const Ref& reference, Comp comp) {
 	}));
 }
 
-template<SpltCoef::IsDense Matrix>
+template<typename Matrix>
+requires SpltCoef::IsDense<Matrix> || SpltCoef::IsPlanar<Matrix>
 void compare(const Matrix& matrix) {
 	compare(matrix, SplattingCoefficientMatrixDense, compare<Type::RegionMask, Type::RegionMask>);
 }
 
+//Ground truth is always computed with sorted emission, so sparse output must not need sorting.
 template<SpltCoef::IsSparse Matrix>
-void compare(Matrix& matrix) {
-	matrix.sort();
+void compare(const Matrix& matrix) {
+	CHECK(matrix.isSorted());
+	compare(matrix, SplattingCoefficientMatrixSparse, [](const auto source, const auto target) static {
+		const auto [src_region_id, src_value] = source;
+		const auto [tgt_region_id, tgt_value] = target;
+		return src_region_id == tgt_region_id && compare(src_value, tgt_value);
+	});
+}
+
+template<SpltCoef::IsTopK Matrix>
+void compare(const Matrix& matrix) {
+	//The reference regionfield has no more regions than the capacity, so nothing is truncated.
+	static_assert(Regionfield::RegionCount <= Matrix::Capacity);
 	compare(matrix, SplattingCoefficientMatrixSparse, [](const auto source, const auto target) static {
 		const auto [src_region_id, src_value] = source;
 		const auto [tgt_region_id, tgt_value] = target;
@@ -156,12 +176,29 @@ void compare(Matrix& matrix) {
 	});
 }
 
+template<SpltCoef::IsCompactSparse Matrix>
+void compare(const Matrix& matrix) {
+	//Quantised values are only accurate up to the precision of the storage type.
+	static constexpr float Tolerance = Matrix::IsQuantised ? 1.0F / std::numeric_limits<typename Matrix::StorageType>::max() : 1e-6F;
+
+	CHECK(matrix.isSorted());
+	compare(matrix, SplattingCoefficientMatrixSparse, [](const auto source, const auto target) static {
+		const auto [src_region_id, src_value] = source;
+		const auto [tgt_region_id, tgt_value] = target;
+		return src_region_id == tgt_region_id && WithinAbs(tgt_value, Tolerance).match(src_value);
+	});
 }
 
 }
 
 }
 
+}
+
+Regionfield GndTth::loadRegionfield() {
+	return Reference::Regionfield::load(false);
+}
+
 //NOLINTNEXTLINE(readability-function-cognitive-complexity)
 void GndTth::checkSplattingCoefficient(DisRegRep::Splatting::OccupancyConvolution::Full::Base& splatting) {
 	using DisRegRep::Splatting::OccupancyConvolution::Full::Base;
@@ -214,7 +251,8 @@ void GndTth::checkSplattingCoefficient(DisRegRep::Splatting::OccupancyConvolutio
 
 	WHEN("It is invoked with ground truth data") {
 		namespace CurrentRef = Reference::OccupancyConvolution::Full;
-		array<any, tuple_size_v<Splt::Container::CombinationType>> memory;
+		//Every container trait has its own scratch memory, such that outputs of all traits remain valid at the same time.
+		array<any, tuple_size_v<decltype(Splt::Container::AllCombination)>> memory;
 
 		splatting.Radius = CurrentRef::Radius;
 		const auto result = apply([&splatting = std::as_const(splatting), &memory](const auto... trait) {
@@ -224,15 +262,168 @@ void GndTth::checkSplattingCoefficient(DisRegRep::Splatting::OccupancyConvolutio
 
 				const Base::InvokeInfo invoke_info {
 					.Offset = transposed ? CurrentRef::OffsetTransposed : CurrentRef::Offset,
-					.Extent = transposed ? CurrentRef::ExtentTransposed : CurrentRef::Extent
+					.Extent = transposed ? CurrentRef::ExtentTransposed : CurrentRef::Extent,
+					.Sorted = true
 				};
 				return tie(splatting(trait, invoke_info, rf, memory)...);
 			}, memory);
-		}, Splt::Container::Combination);
+		}, Splt::Container::AllCombination);
 
 		THEN("Splatting coefficients computed are correct") {
 			apply([](auto&... matrix) static { (CurrentRef::compare(matrix), ...); }, result);
 		}
 
 	}
+
+	WHEN("It is invoked with ground truth data through a cropped and transposed regionfield view") {
+		namespace CurrentRef = Reference::OccupancyConvolution::Full;
+
+		splatting.Radius = CurrentRef::Radius;
+		const bool transposed = splatting.isTransposed();
+		const Regionfield rf = Reference::Regionfield::load(false);
+		const RegionfieldView rf_view = transposed ? RegionfieldView(rf).transpose() : RegionfieldView(rf);
+
+		const Base::DimensionType offset = transposed ? CurrentRef::OffsetTransposed : CurrentRef::Offset,
+			extent = transposed ? CurrentRef::ExtentTransposed : CurrentRef::Extent;
+		//Only keep the footprint of the splatting.
+		const RegionfieldView footprint = rf_view.crop(offset - CurrentRef::Radius, extent + 2U * CurrentRef::Radius);
+
+		THEN("Splatting coefficients computed are correct") {
+			apply([&splatting = std::as_const(splatting), &footprint, &extent](const auto... trait) {
+				any memory;
+				(CurrentRef::compare(splatting(trait, {
+					.Offset = Base::DimensionType(CurrentRef::Radius),
+					.Extent = extent,
+					.Sorted = true
+				}, footprint, memory)), ...);
+			}, Splt::Container::Combination);
+		}
+
+	}
+
+	WHEN("It is invoked with ground truth data through a blocked regionfield") {
+		namespace CurrentRef = Reference::OccupancyConvolution::Full;
+
+		splatting.Radius = CurrentRef::Radius;
+		const bool transposed = splatting.isTransposed();
+		const Regionfield rf = Reference::Regionfield::load(transposed);
+		const RegionfieldView::BlockedMappingType blocked_mapping(toExtent(rf.extent()));
+		auto blocked_rf = vector<Regionfield::ValueType>(blocked_mapping.required_span_size());
+		const auto blocked_rf_md = mdspan(blocked_rf.data(), blocked_mapping);
+		const auto rf_md = rf.mdspan();
+		for (const auto [x, y] : cartesian_product(iota(Regionfield::IndexType {}, rf_md.extent(0U)),
+			iota(Regionfield::IndexType {}, rf_md.extent(1U)))) {
+			blocked_rf_md[x, y] = rf_md[x, y];
+		}
+		const auto rf_view = RegionfieldView(RegionfieldView::BlockedMdSpanType(blocked_rf.data(), blocked_mapping), rf.RegionCount);
+
+		THEN("Splatting coefficients computed are correct") {
+			apply([&splatting = std::as_const(splatting), &rf_view, transposed](const auto... trait) {
+				any memory;
+				(CurrentRef::compare(splatting(trait, {
+					.Offset = transposed ? CurrentRef::OffsetTransposed : CurrentRef::Offset,
+					.Extent = transposed ? CurrentRef::ExtentTransposed : CurrentRef::Extent,
+					.Sorted = true
+				}, rf_view, memory)), ...);
+			}, Splt::Container::Combination);
+		}
+
+	}
+
+	WHEN("It is invoked with ground truth data through a packed regionfield") {
+		namespace CurrentRef = Reference::OccupancyConvolution::Full;
+		using BoundaryMode = Base::BoundaryMode;
+
+		splatting.Radius = CurrentRef::Radius;
+		const bool transposed = splatting.isTransposed();
+		const Regionfield rf = Reference::Regionfield::load(transposed);
+		PackedRegionfield packed_rf;
+		packed_rf.pack(rf);
+
+		THEN("Splatting coefficients computed are correct without unpacking") {
+			apply([&splatting = std::as_const(splatting), &packed_rf, transposed](const auto... trait) {
+				any memory;
+				(CurrentRef::compare(splatting(trait, {
+					.Offset = transposed ? CurrentRef::OffsetTransposed : CurrentRef::Offset,
+					.Extent = transposed ? CurrentRef::ExtentTransposed : CurrentRef::Extent,
+					.Sorted = true
+				}, packed_rf, memory)), ...);
+			}, Splt::Container::Combination);
+		}
+
+		AND_WHEN("Elements outside the packed regionfield are resolved by a boundary mode") {
+			const auto boundary = GENERATE(values({ BoundaryMode::Clamp, BoundaryMode::Mirror, BoundaryMode::Wrap }));
+			const Base::InvokeInfo invoke_info {
+				.Offset = Base::DimensionType(0U),
+				.Extent = rf.extent(),
+				.Boundary = boundary
+			};
+
+			any memory, packed_memory;
+			const auto& matrix = splatting(Splt::Container::DenseKernelDenseOutputTrait, invoke_info, rf, memory);
+			const auto& packed_matrix = splatting(Splt::Container::DenseKernelDenseOutputTrait, invoke_info, packed_rf, packed_memory);
+
+			THEN("Splatting coefficients are the same as those of the unpacked regionfield") {
+				CHECK_THAT(packed_matrix.range() | View::Functional::Dereference, RangeEquals(matrix.range() | View::Functional::Dereference,
+					[](const auto source, const auto target) static {
+						return all_of(zip_transform(CurrentRef::compare<Type::RegionMask, Type::RegionMask>, source, target), identity {});
+					}));
+			}
+
+		}
+
+	}
+
+	WHEN("It is invoked with a boundary mode over the whole regionfield") {
+		namespace CurrentRef = Reference::OccupancyConvolution::Full;
+		using BoundaryMode = Base::BoundaryMode;
+		using SignedType = std::make_signed_t<Base::DimensionType::value_type>;
+
+		const auto boundary = GENERATE(values({ BoundaryMode::Clamp, BoundaryMode::Mirror, BoundaryMode::Wrap }));
+		splatting.Radius = CurrentRef::Radius;
+		const auto r = static_cast<SignedType>(CurrentRef::Radius);
+
+		const Regionfield rf = Reference::Regionfield::load(false);
+		const Base::DimensionType rf_extent = rf.extent();
+		//Pad the regionfield explicitly, which is what the application would have done without boundary mode.
+		Regionfield padded;
+		padded.RegionCount = rf.RegionCount;
+		padded.resize(rf_extent + 2U * CurrentRef::Radius);
+		const auto resolve = [boundary](const SignedType coordinate, const auto size) {
+			const auto n = static_cast<SignedType>(size);
+			const SignedType wrapped = (coordinate % n + n) % n,
+				mirrored = (coordinate % (2 * n) + 2 * n) % (2 * n);
+			switch (boundary) {
+			case BoundaryMode::Clamp: return std::ranges::clamp(coordinate, SignedType {}, n - 1);
+			case BoundaryMode::Mirror: return mirrored < n ? mirrored : 2 * n - 1 - mirrored;
+			default: return wrapped;
+			}
+		};
+		const auto rf_md = rf.mdspan();
+		const auto padded_md = padded.mdspan();
+		for (const auto x : iota(SignedType {}, static_cast<SignedType>(padded_md.extent(0U)))) {
+			for (const auto y : iota(SignedType {}, static_cast<SignedType>(padded_md.extent(1U)))) {
+				padded_md[x, y] = rf_md[resolve(x - r, rf_extent.x), resolve(y - r, rf_extent.y)];
+			}
+		}
+
+		any memory, padded_memory;
+		const auto& matrix = splatting(Splt::Container::DenseKernelDenseOutputTrait, {
+			.Offset = Base::DimensionType(0U),
+			.Extent = rf_extent,
+			.Boundary = boundary
+		}, rf, memory);
+		const auto& padded_matrix = splatting(Splt::Container::DenseKernelDenseOutputTrait, {
+			.Offset = Base::DimensionType(CurrentRef::Radius),
+			.Extent = rf_extent
+		}, padded, padded_memory);
+
+		THEN("Splatting coefficients are the same as those of an explicitly padded regionfield") {
+			CHECK_THAT(matrix.range() | View::Functional::Dereference, RangeEquals(padded_matrix.range() | View::Functional::Dereference,
+				[](const auto source, const auto target) static {
+					return all_of(zip_transform(CurrentRef::compare<Type::RegionMask, Type::RegionMask>, source, target), identity {});
+				}));
+		}
+
+	}
 }
\ No newline at end of file
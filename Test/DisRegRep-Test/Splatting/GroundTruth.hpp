@@ -1,5 +1,7 @@
 #pragma once
 
+#include <DisRegRep/Container/Regionfield.hpp>
+
 #include <DisRegRep/Splatting/OccupancyConvolution/Full/Base.hpp>
 
 /**
@@ -7,6 +9,13 @@
  */
 namespace DisRegRep::Test::Splatting::GroundTruth {
 
+/**
+ * @brief Load the regionfield from which the dataset is computed.
+ *
+ * @return The reference regionfield.
+ */
+[[nodiscard]] Container::Regionfield loadRegionfield();
+
 /**
  * @brief Check splatting coefficients computed by various splatting.
  *
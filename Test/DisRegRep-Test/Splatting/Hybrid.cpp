@@ -0,0 +1,107 @@
+#include <DisRegRep/Splatting/OccupancyConvolution/Full/Vanilla.hpp>
+#include <DisRegRep/Splatting/Hybrid.hpp>
+#include <DisRegRep/Splatting/Container.hpp>
+
+#include <DisRegRep/Container/Regionfield.hpp>
+
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <any>
+#include <variant>
+
+#include <algorithm>
+#include <ranges>
+
+#include <type_traits>
+
+namespace Splt = DisRegRep::Splatting;
+using DisRegRep::Splatting::Hybrid, DisRegRep::Splatting::OccupancyConvolution::Full::Vanilla,
+	DisRegRep::Container::Regionfield;
+
+using Catch::Matchers::WithinAbs;
+
+using std::any, std::visit, std::holds_alternative;
+using std::ranges::count_if, std::ranges::for_each,
+	std::views::iota, std::views::zip;
+using std::is_same_v, std::remove_cvref_t;
+
+SCENARIO("Choose dense or sparse containers for every tile of a splatting by region diversity", "[Splatting][Hybrid]") {
+
+	GIVEN("A splatting and a regionfield with a single region on the left and many regions on the right") {
+		Vanilla splatting;
+		splatting.Radius = 2U;
+		const Splt::Base::InvokeInfo invoke_info {
+			.Offset = splatting.minimumOffset(),
+			.Extent = Splt::Base::DimensionType(16U, 8U),
+			//Order of sparse entries depends on where the splatting starts, so they are emitted in order to be compared.
+			.Sorted = true
+		};
+
+		Regionfield rf;
+		rf.RegionCount = 8U;
+		rf.resize(splatting.minimumRegionfieldDimension(invoke_info));
+		//Footprint of the first tile only covers the single-region part of the regionfield.
+		const auto rf_md = rf.mdspan();
+		for (const auto x : iota(Regionfield::IndexType {}, rf_md.extent(0U))) {
+			for (const auto y : iota(Regionfield::IndexType {}, rf_md.extent(1U))) {
+				rf_md[x, y] = x < 12U ? 0U : static_cast<Regionfield::ValueType>((x + y) % rf.RegionCount);
+			}
+		}
+
+		AND_GIVEN("A hybrid executor whose tiles lie on both sides of the density threshold") {
+			Hybrid hybrid;
+			hybrid.TileSize = Hybrid::DimensionType(8U);
+			hybrid.DenseThreshold = 0.5F;
+
+			WHEN("It is invoked") {
+				const auto tile = hybrid(splatting, invoke_info, rf);
+
+				THEN("Every tile is covered, and both containers are chosen") {
+					REQUIRE(tile.size() == 2U);
+					CHECK(count_if(tile, [](const auto& t) static { return holds_alternative<Hybrid::SparseTrait::MaskOutputType>(t.Output); }) == 1U);
+					CHECK(holds_alternative<Hybrid::SparseTrait::MaskOutputType>(tile.front().Output));
+					CHECK(holds_alternative<Hybrid::DenseTrait::MaskOutputType>(tile.back().Output));
+				}
+
+				THEN("Region masks of every tile are the same as those computed by the splatting using the chosen container only") {
+					any memory_dense, memory_sparse;
+					const auto& dense = splatting(Hybrid::DenseTrait {}, invoke_info, rf, memory_dense);
+					const auto& sparse = splatting(Hybrid::SparseTrait {}, invoke_info, rf, memory_sparse);
+
+					for_each(tile, [&](const Hybrid::Tile& t) {
+						const Hybrid::DimensionType tile_offset = t.InvokeInfo_.Offset - invoke_info.Offset;
+						visit([&](const auto& output) {
+							using OutputType = remove_cvref_t<decltype(output)>;
+							for (const auto x : iota(Hybrid::DimensionType::value_type {}, t.InvokeInfo_.Extent.x)) {
+								for (const auto y : iota(Hybrid::DimensionType::value_type {}, t.InvokeInfo_.Extent.y)) {
+									const auto actual = output.range2d()[x][y];
+									if constexpr (is_same_v<OutputType, Hybrid::DenseTrait::MaskOutputType>) {
+										const auto expected = dense.range2d()[tile_offset.x + x][tile_offset.y + y];
+										for_each(zip(*actual, *expected), [](const auto mask) static {
+											const auto [actual_mask, expected_mask] = mask;
+											CHECK_THAT(actual_mask, WithinAbs(expected_mask, 1e-6F));
+										});
+									} else {
+										const auto expected = sparse.range2d()[tile_offset.x + x][tile_offset.y + y];
+										REQUIRE((*actual).size() == (*expected).size());
+										for_each(zip(*actual, *expected), [](const auto element) static {
+											const auto [actual_element, expected_element] = element;
+											CHECK(actual_element.Identifier == expected_element.Identifier);
+											CHECK_THAT(actual_element.Value, WithinAbs(expected_element.Value, 1e-6F));
+										});
+									}
+								}
+							}
+						}, t.Output);
+					});
+				}
+
+			}
+
+		}
+
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,140 @@
+#include <DisRegRep/Splatting/OccupancyConvolution/Approximate/MultiResolution.hpp>
+#include <DisRegRep/Splatting/OccupancyConvolution/Full/Vanilla.hpp>
+#include <DisRegRep/Splatting/Container.hpp>
+
+#include <DisRegRep/Container/Regionfield.hpp>
+
+#include <DisRegRep/RegionfieldGenerator/ExecutionPolicy.hpp>
+#include <DisRegRep/RegionfieldGenerator/Uniform.hpp>
+
+#include <catch2/generators/catch_generators_adapters.hpp>
+#include <catch2/generators/catch_generators_random.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <catch2/catch_get_random_seed.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <glm/gtc/type_ptr.hpp>
+
+#include <any>
+
+#include <algorithm>
+#include <ranges>
+
+#include <cstdint>
+
+namespace OC = DisRegRep::Splatting::OccupancyConvolution;
+namespace Splt = DisRegRep::Splatting;
+namespace RfGenExec = DisRegRep::RegionfieldGenerator::ExecutionPolicy;
+using DisRegRep::Container::Regionfield, DisRegRep::RegionfieldGenerator::Uniform;
+
+using Catch::Matchers::WithinAbs;
+
+using glm::make_vec2;
+
+using std::any;
+using std::ranges::for_each,
+	std::views::zip;
+
+SCENARIO("Approximate occupancy convolution of a large kernel by splatting a reduced regionfield", "[Splatting][OccupancyConvolution][Approximate][MultiResolution]") {
+
+	GIVEN("A multi-resolution approximate occupancy convolution") {
+		OC::Approximate::MultiResolution multi_resolution;
+		multi_resolution.Radius = GENERATE(values<OC::Base::KernelSizeType>({ 24U, 40U }));
+		multi_resolution.Tolerance = GENERATE(values({ 0.25F, 0.5F }));
+
+		THEN("Splatting coefficient matrix is original") {
+			CHECK_FALSE(multi_resolution.isTransposed());
+		}
+
+		THEN("Reduction factor is odd and its error bound meets the tolerance") {
+			const auto f = multi_resolution.reductionFactor();
+			CHECK(f % 2U == 1U);
+			if (f > 1U) {
+				CHECK(multi_resolution.errorBound(f) <= multi_resolution.Tolerance);
+			}
+		}
+
+		AND_GIVEN("A random regionfield") {
+			const Splt::Base::InvokeInfo invoke_info {
+				.Offset = multi_resolution.minimumOffset(),
+				.Extent = make_vec2(GENERATE(take(2U, chunk(2U, random<std::uint_least8_t>(1U, 40U)))).data())
+			};
+			Regionfield rf;
+			rf.RegionCount = GENERATE(take(2U, random<Regionfield::ValueType>(1U, 6U)));
+			rf.resize(multi_resolution.minimumRegionfieldDimension(invoke_info));
+			static constexpr Uniform Generator;
+			Generator(RfGenExec::SingleThreadingTrait, rf, {
+				.Seed = Catch::getSeed()
+			});
+
+			WHEN("It is invoked") {
+				OC::Full::Vanilla vanilla;
+				vanilla.Radius = multi_resolution.Radius;
+
+				any memory_approximate, memory_exact;
+				const auto& approximate = multi_resolution(Splt::Container::DenseKernelDenseOutputTrait, invoke_info, rf, memory_approximate);
+				const auto& exact = vanilla(Splt::Container::DenseKernelDenseOutputTrait, invoke_info, rf, memory_exact);
+
+				THEN("Every region mask is within the tolerance of the exact one") {
+					for_each(zip(approximate.range(), exact.range()), [tolerance = multi_resolution.Tolerance](const auto proxy) {
+						const auto [approximate_proxy, exact_proxy] = proxy;
+						for_each(zip(*approximate_proxy, *exact_proxy), [tolerance](const auto mask) {
+							const auto [approximate_mask, exact_mask] = mask;
+							CHECK_THAT(approximate_mask, WithinAbs(exact_mask, tolerance));
+						});
+					});
+				}
+
+			}
+
+		}
+
+	}
+
+	GIVEN("A multi-resolution approximate occupancy convolution with a large radius and a realistic tolerance") {
+		OC::Approximate::MultiResolution multi_resolution;
+		multi_resolution.Radius = GENERATE(values<OC::Base::KernelSizeType>({ 64U, 128U }));
+		multi_resolution.Tolerance = 0.05F;
+
+		THEN("Regionfield is reduced") {
+			const auto f = multi_resolution.reductionFactor();
+			CHECK(f > 1U);
+			CHECK(multi_resolution.errorBound(f) <= multi_resolution.Tolerance);
+		}
+
+		WHEN("It is invoked on a random regionfield") {
+			const Splt::Base::InvokeInfo invoke_info {
+				.Offset = multi_resolution.minimumOffset(),
+				.Extent = make_vec2(GENERATE(take(1U, chunk(2U, random<std::uint_least8_t>(1U, 12U)))).data())
+			};
+			Regionfield rf;
+			rf.RegionCount = GENERATE(take(1U, random<Regionfield::ValueType>(2U, 6U)));
+			rf.resize(multi_resolution.minimumRegionfieldDimension(invoke_info));
+			static constexpr Uniform Generator;
+			Generator(RfGenExec::SingleThreadingTrait, rf, {
+				.Seed = Catch::getSeed()
+			});
+
+			OC::Full::Vanilla vanilla;
+			vanilla.Radius = multi_resolution.Radius;
+
+			any memory_approximate, memory_exact;
+			const auto& approximate = multi_resolution(Splt::Container::DenseKernelDenseOutputTrait, invoke_info, rf, memory_approximate);
+			const auto& exact = vanilla(Splt::Container::DenseKernelDenseOutputTrait, invoke_info, rf, memory_exact);
+
+			THEN("Every region mask is within the tolerance of the exact one") {
+				for_each(zip(approximate.range(), exact.range()), [tolerance = multi_resolution.Tolerance](const auto proxy) {
+					const auto [approximate_proxy, exact_proxy] = proxy;
+					for_each(zip(*approximate_proxy, *exact_proxy), [tolerance](const auto mask) {
+						const auto [approximate_mask, exact_mask] = mask;
+						CHECK_THAT(approximate_mask, WithinAbs(exact_mask, tolerance));
+					});
+				});
+			}
+
+		}
+
+	}
+
+}
\ No newline at end of file
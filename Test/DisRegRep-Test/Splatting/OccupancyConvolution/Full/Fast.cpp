@@ -1,10 +1,38 @@
 #include <DisRegRep/Splatting/OccupancyConvolution/Full/Fast.hpp>
+#include <DisRegRep/Splatting/OccupancyConvolution/Full/Vanilla.hpp>
+#include <DisRegRep/Splatting/Container.hpp>
+
+#include <DisRegRep/Container/Regionfield.hpp>
+
+#include <DisRegRep/RegionfieldGenerator/ExecutionPolicy.hpp>
+#include <DisRegRep/RegionfieldGenerator/Uniform.hpp>
 
 #include <DisRegRep-Test/Splatting/GroundTruth.hpp>
 
+#include <catch2/generators/catch_generators_adapters.hpp>
+#include <catch2/generators/catch_generators_random.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <catch2/catch_get_random_seed.hpp>
 #include <catch2/catch_test_macros.hpp>
 
-using DisRegRep::Splatting::OccupancyConvolution::Full::Fast;
+#include <any>
+
+#include <algorithm>
+#include <ranges>
+
+#include <cstdint>
+
+namespace RfGenExec = DisRegRep::RegionfieldGenerator::ExecutionPolicy;
+namespace Splt = DisRegRep::Splatting;
+using DisRegRep::Splatting::OccupancyConvolution::Full::Fast, DisRegRep::Splatting::OccupancyConvolution::Full::Vanilla,
+	DisRegRep::Container::Regionfield, DisRegRep::RegionfieldGenerator::Uniform;
+
+using Catch::Matchers::WithinAbs;
+
+using std::any;
+using std::ranges::for_each,
+	std::views::zip;
 
 namespace GndTth = DisRegRep::Test::Splatting::GroundTruth;
 
@@ -18,6 +46,47 @@ SCENARIO("Use an optimised 2D convolution to compute region occupancy from a reg
 		}
 
 		GndTth::checkSplattingCoefficient(splatting);
+
+		AND_GIVEN("A radius larger than that of the reference regionfield") {
+			splatting.Radius = GENERATE(values<Fast::KernelSizeType>({ 8U, 9U }));
+			const Splt::Base::InvokeInfo invoke_info {
+				.Offset = splatting.minimumOffset(),
+				.Extent = Splt::Base::DimensionType(GENERATE(take(2U, random<std::uint_least8_t>(1U, 24U))))
+			};
+			Regionfield rf;
+			//Histogram of a specialised kernel is only held on the stack up to a number of regions.
+			rf.RegionCount = GENERATE(
+				take(1U, random<Regionfield::ValueType>(1U, 16U)),
+				take(1U, random<Regionfield::ValueType>(17U, 24U))
+			);
+			rf.resize(splatting.minimumRegionfieldDimension(invoke_info));
+			static constexpr Uniform Generator;
+			Generator(RfGenExec::SingleThreadingTrait, rf, {
+				.Seed = Catch::getSeed()
+			});
+
+			WHEN("It is invoked on the transposed regionfield") {
+				Vanilla vanilla;
+				vanilla.Radius = splatting.Radius;
+
+				any memory_fast, memory_vanilla;
+				//Both the regionfield and the invoke info are square, so transposing the input cancels the transposed output.
+				const auto& fast = splatting(Splt::Container::DenseKernelDenseOutputTrait, invoke_info, rf.transpose(), memory_fast);
+				const auto& exact = vanilla(Splt::Container::DenseKernelDenseOutputTrait, invoke_info, rf, memory_vanilla);
+
+				THEN("Region masks are the same as those of the vanilla convolution") {
+					for_each(zip(fast.range(), exact.range()), [](const auto proxy) static {
+						const auto [fast_proxy, exact_proxy] = proxy;
+						for_each(zip(*fast_proxy, *exact_proxy), [](const auto mask) static {
+							const auto [fast_mask, exact_mask] = mask;
+							CHECK_THAT(fast_mask, WithinAbs(exact_mask, 1e-6F));
+						});
+					});
+				}
+
+			}
+
+		}
 	}
 
 }
\ No newline at end of file
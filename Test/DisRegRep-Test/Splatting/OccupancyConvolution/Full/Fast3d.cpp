@@ -0,0 +1,85 @@
+#include <DisRegRep/Splatting/OccupancyConvolution/Full/Fast3d.hpp>
+
+#include <DisRegRep/Container/Regionfield3d.hpp>
+
+#include <catch2/generators/catch_generators_adapters.hpp>
+#include <catch2/generators/catch_generators_random.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <catch2/catch_get_random_seed.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <glm/gtc/type_ptr.hpp>
+
+#include <vector>
+
+#include <algorithm>
+#include <ranges>
+
+#include <random>
+
+#include <cstdint>
+
+using DisRegRep::Splatting::OccupancyConvolution::Full::Fast3d,
+	DisRegRep::Container::Regionfield3d;
+
+using Catch::Matchers::WithinAbs;
+
+using glm::make_vec3;
+
+using std::vector;
+using std::ranges::for_each, std::ranges::generate,
+	std::views::cartesian_product, std::views::iota, std::views::zip;
+
+SCENARIO("Use an optimised 3D convolution to compute region occupancy from a volumetric regionfield", "[Splatting][OccupancyConvolution][Full][Fast3d]") {
+
+	GIVEN("A fast volumetric occupancy convolution and a random volumetric regionfield") {
+		Fast3d splatting;
+		splatting.Radius = GENERATE(take(2U, random<std::uint_least8_t>(0U, 3U)));
+
+		const Fast3d::InvokeInfo invoke_info {
+			.Offset = splatting.minimumOffset(),
+			.Extent = make_vec3(GENERATE(take(2U, chunk(3U, random<std::uint_least8_t>(1U, 8U)))).data())
+		};
+		Regionfield3d rf;
+		rf.RegionCount = GENERATE(take(2U, random<Regionfield3d::ValueType>(1U, 6U)));
+		rf.resize(splatting.minimumRegionfieldDimension(invoke_info));
+		generate(rf.span(), [rng = std::minstd_rand(Catch::getSeed()), dist = std::uniform_int_distribution<unsigned int>(
+			0U, rf.RegionCount - 1U)]() mutable { return static_cast<Regionfield3d::ValueType>(dist(rng)); });
+
+		WHEN("It is invoked") {
+			vector<Fast3d::IndexType> visited_row;
+			auto sink = [&](const Fast3d::IndexType row, const Fast3d::MaskOutputType& output) {
+				visited_row.push_back(row);
+
+				const auto [offset, extent] = invoke_info;
+				const auto r = splatting.Radius, d = 2U * r + 1U;
+				const auto rf_view = rf.mdspan();
+
+				//Sections cannot be nested in the sink because it is invoked repeatedly.
+				for_each(zip(cartesian_product(iota(Fast3d::IndexType {}, extent.y), iota(Fast3d::IndexType {}, extent.z)),
+					output.range()), [&](const auto it) {
+					const auto [coordinate, proxy] = it;
+					const auto [column, layer] = coordinate;
+					vector<unsigned int> occupancy(rf.RegionCount);
+					for_each(cartesian_product(iota(0U, d), iota(0U, d), iota(0U, d)), [&](const auto kernel_coordinate) {
+						const auto [i, j, k] = kernel_coordinate;
+						occupancy[rf_view[offset.x + row - r + i, offset.y + column - r + j, offset.z + layer - r + k]]++;
+					});
+					for_each(zip(*proxy, occupancy), [norm_factor = static_cast<double>(d * d * d)](const auto mask_occupancy) {
+						const auto [mask, count] = mask_occupancy;
+						CHECK_THAT(mask, WithinAbs(count / norm_factor, 1e-5));
+					});
+				});
+			};
+			splatting(invoke_info, rf, sink);
+
+			THEN("Every row is visited in order, and region masks agree with a brute-force convolution") {
+				CHECK(std::ranges::equal(visited_row, iota(Fast3d::IndexType {}, invoke_info.Extent.x)));
+			}
+
+		}
+
+	}
+
+}
\ No newline at end of file
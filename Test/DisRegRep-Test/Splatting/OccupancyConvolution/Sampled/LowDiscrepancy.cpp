@@ -0,0 +1,100 @@
+#include <DisRegRep/Splatting/OccupancyConvolution/Sampled/LowDiscrepancy.hpp>
+#include <DisRegRep/Splatting/Container.hpp>
+
+#include <DisRegRep/Container/Regionfield.hpp>
+
+#include <DisRegRep/Core/View/Functional.hpp>
+
+#include <DisRegRep/RegionfieldGenerator/ExecutionPolicy.hpp>
+#include <DisRegRep/RegionfieldGenerator/Uniform.hpp>
+
+#include <catch2/generators/catch_generators_adapters.hpp>
+#include <catch2/generators/catch_generators_random.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include <catch2/matchers/catch_matchers_range_equals.hpp>
+
+#include <catch2/catch_get_random_seed.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <glm/gtc/type_ptr.hpp>
+
+#include <any>
+#include <tuple>
+
+#include <algorithm>
+#include <functional>
+#include <ranges>
+
+#include <cstdint>
+
+namespace Sampled = DisRegRep::Splatting::OccupancyConvolution::Sampled;
+namespace Splt = DisRegRep::Splatting;
+namespace RfGenExec = DisRegRep::RegionfieldGenerator::ExecutionPolicy;
+using DisRegRep::Container::Regionfield, DisRegRep::RegionfieldGenerator::Uniform;
+
+using Catch::Matchers::RangeEquals, Catch::Matchers::WithinAbs;
+
+using glm::make_vec2;
+
+using std::any, std::apply;
+using std::ranges::equal, std::ranges::fold_left, std::ranges::for_each;
+
+SCENARIO("Take low-discrepancy samples from the convolution kernel to compute region occupancy from a regionfield", "[Splatting][OccupancyConvolution][Sampled][LowDiscrepancy]") {
+
+	GIVEN("A low-discrepancy sampled occupancy convolution") {
+		Sampled::LowDiscrepancy low_discrepancy;
+
+		THEN("Splatting coefficient matrix is original") {
+			CHECK_FALSE(low_discrepancy.isTransposed());
+		}
+
+		AND_GIVEN("A random regionfield and sampling parameters") {
+			low_discrepancy.Radius = GENERATE(take(2U, random<std::uint_least8_t>(0U, 6U)));
+			low_discrepancy.Sample = GENERATE(take(2U, random<std::uint_least8_t>(1U, 30U)));
+			low_discrepancy.Seed = Catch::getSeed();
+
+			const Splt::Base::InvokeInfo invoke_info {
+				.Offset = low_discrepancy.minimumOffset(),
+				.Extent = make_vec2(GENERATE(take(2U, chunk(2U, random<std::uint_least8_t>(1U, 20U)))).data())
+			};
+			Regionfield rf;
+			rf.RegionCount = GENERATE(take(2U, random<Regionfield::ValueType>(1U, 10U)));
+			rf.resize(low_discrepancy.minimumRegionfieldDimension(invoke_info));
+			static constexpr Uniform Generator;
+			Generator(RfGenExec::SingleThreadingTrait, rf, {
+				.Seed = Catch::getSeed()
+			});
+
+			WHEN("It is invoked") {
+				any memory;
+				const auto& output = low_discrepancy(Splt::Container::DenseKernelDenseOutputTrait, invoke_info, rf, memory);
+
+				THEN("Region masks at every coordinate sum up to one") {
+					for_each(output.range(), [](const auto proxy) {
+						CHECK_THAT(fold_left(*proxy, 0.0, std::plus {}), WithinAbs(1.0, 1e-5));
+					});
+				}
+
+			}
+
+			WHEN("It is invoked twice with different scratch memories") {
+
+				THEN("Splatting coefficients computed are identical") {
+					apply([&](const auto... trait) {
+						([&](const auto current_trait) {
+							any memory_first, memory_second;
+							auto& output_first = low_discrepancy(current_trait, invoke_info, rf, memory_first);
+							auto& output_second = low_discrepancy(current_trait, invoke_info, rf, memory_second);
+							CHECK_THAT(output_first.range() | DisRegRep::Core::View::Functional::Dereference,
+								RangeEquals(output_second.range() | DisRegRep::Core::View::Functional::Dereference, equal));
+						}(trait), ...);
+					}, Splt::Container::Combination);
+				}
+
+			}
+
+		}
+
+	}
+
+}
\ No newline at end of file
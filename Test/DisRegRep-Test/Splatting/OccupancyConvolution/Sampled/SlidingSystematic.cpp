@@ -0,0 +1,91 @@
+#include <DisRegRep/Splatting/OccupancyConvolution/Sampled/SlidingSystematic.hpp>
+#include <DisRegRep/Splatting/OccupancyConvolution/Sampled/Systematic.hpp>
+#include <DisRegRep/Splatting/Container.hpp>
+
+#include <DisRegRep/Container/Regionfield.hpp>
+
+#include <DisRegRep/Core/View/Functional.hpp>
+
+#include <DisRegRep/RegionfieldGenerator/ExecutionPolicy.hpp>
+#include <DisRegRep/RegionfieldGenerator/Uniform.hpp>
+
+#include <catch2/generators/catch_generators_adapters.hpp>
+#include <catch2/generators/catch_generators_random.hpp>
+#include <catch2/matchers/catch_matchers_range_equals.hpp>
+
+#include <catch2/catch_get_random_seed.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <glm/gtc/type_ptr.hpp>
+
+#include <any>
+#include <tuple>
+
+#include <algorithm>
+
+#include <cstdint>
+
+namespace Sampled = DisRegRep::Splatting::OccupancyConvolution::Sampled;
+namespace Splt = DisRegRep::Splatting;
+namespace RfGenExec = DisRegRep::RegionfieldGenerator::ExecutionPolicy;
+using DisRegRep::Container::Regionfield, DisRegRep::RegionfieldGenerator::Uniform;
+
+using Catch::Matchers::RangeEquals;
+
+using glm::make_vec2;
+
+using std::any, std::apply;
+using std::ranges::equal;
+
+SCENARIO("Slide the lattice of systematic sampling to compute region occupancy from a regionfield", "[Splatting][OccupancyConvolution][Sampled][SlidingSystematic]") {
+
+	GIVEN("A sliding systematic sampled occupancy convolution and a plain systematic sampled occupancy convolution") {
+		Sampled::SlidingSystematic sliding;
+		Sampled::Systematic systematic;
+
+		THEN("Splatting coefficient matrix is original") {
+			CHECK_FALSE(sliding.isTransposed());
+		}
+
+		AND_GIVEN("A random regionfield and sampling parameters") {
+			const auto size = GENERATE(take(3U, chunk(5U, random<std::uint_least8_t>(1U, 6U))));
+			sliding.Radius = systematic.Radius = size[0];
+			sliding.FirstSample = systematic.FirstSample =
+				Sampled::SlidingSystematic::DimensionType(make_vec2(size.data() + 1U)) % sliding.diametre();
+			sliding.Interval = systematic.Interval = make_vec2(size.data() + 3U);
+
+			const Splt::Base::InvokeInfo invoke_info {
+				.Offset = sliding.minimumOffset(),
+				.Extent = make_vec2(GENERATE(take(2U, chunk(2U, random<std::uint_least8_t>(1U, 20U)))).data()),
+				//Sparse element order depends on the order of kernel modification, unless they are emitted in order.
+				.Sorted = true
+			};
+			Regionfield rf;
+			rf.RegionCount = GENERATE(take(2U, random<Regionfield::ValueType>(1U, 10U)));
+			rf.resize(sliding.minimumRegionfieldDimension(invoke_info));
+			static constexpr Uniform Generator;
+			Generator(RfGenExec::SingleThreadingTrait, rf, {
+				.Seed = Catch::getSeed()
+			});
+
+			WHEN("Both are invoked with the same regionfield") {
+
+				THEN("Splatting coefficients computed are identical") {
+					apply([&](const auto... trait) {
+						([&](const auto current_trait) {
+							any memory_sliding, memory_systematic;
+							const auto& output_sliding = sliding(current_trait, invoke_info, rf, memory_sliding);
+							const auto& output_systematic = systematic(current_trait, invoke_info, rf, memory_systematic);
+							CHECK_THAT(output_sliding.range() | DisRegRep::Core::View::Functional::Dereference,
+								RangeEquals(output_systematic.range() | DisRegRep::Core::View::Functional::Dereference, equal));
+						}(trait), ...);
+					}, Splt::Container::Combination);
+				}
+
+			}
+
+		}
+
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,105 @@
+#include <DisRegRep/Splatting/OccupancyConvolution/Sampled/Stochastic.hpp>
+#include <DisRegRep/Splatting/OccupancyConvolution/Full/Vanilla.hpp>
+#include <DisRegRep/Splatting/Container.hpp>
+
+#include <DisRegRep/Container/Regionfield.hpp>
+#include <DisRegRep/Core/Type.hpp>
+
+#include <DisRegRep-Test/Splatting/GroundTruth.hpp>
+
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <catch2/catch_get_random_seed.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <any>
+
+#include <algorithm>
+#include <ranges>
+
+namespace Sampled = DisRegRep::Splatting::OccupancyConvolution::Sampled;
+namespace Splt = DisRegRep::Splatting;
+namespace GndTth = DisRegRep::Test::Splatting::GroundTruth;
+using DisRegRep::Splatting::OccupancyConvolution::Full::Vanilla,
+	DisRegRep::Container::Regionfield,
+	DisRegRep::Core::Type::RegionMask;
+
+using Catch::Matchers::WithinAbs;
+
+using std::any;
+using std::ranges::for_each,
+	std::views::zip;
+
+SCENARIO("Adapt the number of samples of stochastic sampling to an error tolerance", "[Splatting][OccupancyConvolution][Sampled][Stochastic]") {
+
+	GIVEN("A stochastic sampled occupancy convolution and the reference regionfield") {
+		Sampled::Stochastic stochastic;
+		stochastic.Radius = 2U;
+		stochastic.Seed = Catch::getSeed();
+		stochastic.Sample = GENERATE(values<Sampled::Stochastic::KernelSizeType>({ 4U, 16U }));
+		//Large enough that the sampling always stops by the tolerance.
+		stochastic.MaximumSample = 8192U;
+
+		const Regionfield rf = GndTth::loadRegionfield();
+		const Splt::Base::InvokeInfo invoke_info {
+			.Offset = stochastic.minimumOffset(),
+			.Extent = stochastic.maximumExtent(rf, stochastic.minimumOffset())
+		};
+
+		THEN("Sampling is not adaptive by default") {
+			CHECK_FALSE(stochastic.isAdaptive());
+		}
+
+		WHEN("It is invoked without a tolerance") {
+			any memory;
+			static_cast<void>(stochastic(Splt::Container::DenseKernelDenseOutputTrait, invoke_info, rf, memory));
+
+			THEN("The same number of samples is taken from every kernel") {
+				CHECK(stochastic.averageSample(memory) == stochastic.Sample);
+			}
+
+		}
+
+		WHEN("It is invoked with a tolerance, and then with a tighter tolerance") {
+			const RegionMask tolerance = GENERATE(values<RegionMask>({ 0.2F, 0.1F, 0.05F }));
+
+			any memory_loose, memory_tight;
+			stochastic.Tolerance = tolerance;
+			REQUIRE(stochastic.isAdaptive());
+			const auto& loose = stochastic(Splt::Container::DenseKernelDenseOutputTrait, invoke_info, rf, memory_loose);
+			stochastic.Tolerance = tolerance / 2.0F;
+			const auto& tight = stochastic(Splt::Container::DenseKernelDenseOutputTrait, invoke_info, rf, memory_tight);
+
+			THEN("Tighter tolerance never takes fewer samples") {
+				const double sample_loose = stochastic.averageSample(memory_loose), sample_tight = stochastic.averageSample(memory_tight);
+				CHECK(sample_loose >= stochastic.Sample);
+				CHECK(sample_tight >= sample_loose);
+				CHECK(sample_tight < stochastic.MaximumSample);
+			}
+
+			THEN("Region masks are within the tolerance of the exact ones") {
+				Vanilla vanilla;
+				vanilla.Radius = stochastic.Radius;
+				any memory_exact;
+				const auto& exact = vanilla(Splt::Container::DenseKernelDenseOutputTrait, invoke_info, rf, memory_exact);
+
+				//Tolerance bounds a 95% confidence interval, so allow a margin to keep the test deterministic in practice.
+				const auto check = [&exact](const auto& estimate, const RegionMask bound) {
+					for_each(zip(estimate.range(), exact.range()), [bound](const auto proxy) {
+						const auto [estimate_proxy, exact_proxy] = proxy;
+						for_each(zip(*estimate_proxy, *exact_proxy), [bound](const auto mask) {
+							const auto [estimate_mask, exact_mask] = mask;
+							CHECK_THAT(estimate_mask, WithinAbs(exact_mask, 3.0F * bound));
+						});
+					});
+				};
+				check(loose, tolerance);
+				check(tight, tolerance / 2.0F);
+			}
+
+		}
+
+	}
+
+}
\ No newline at end of file
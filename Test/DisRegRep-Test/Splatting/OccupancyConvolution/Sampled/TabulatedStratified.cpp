@@ -0,0 +1,137 @@
+#include <DisRegRep/Splatting/OccupancyConvolution/Sampled/Stratified.hpp>
+#include <DisRegRep/Splatting/OccupancyConvolution/Sampled/TabulatedStratified.hpp>
+#include <DisRegRep/Splatting/OccupancyConvolution/Full/Vanilla.hpp>
+#include <DisRegRep/Splatting/Container.hpp>
+
+#include <DisRegRep/Container/Regionfield.hpp>
+
+#include <DisRegRep/Core/View/Functional.hpp>
+
+#include <DisRegRep/RegionfieldGenerator/ExecutionPolicy.hpp>
+#include <DisRegRep/RegionfieldGenerator/Uniform.hpp>
+
+#include <catch2/generators/catch_generators_adapters.hpp>
+#include <catch2/generators/catch_generators_random.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include <catch2/matchers/catch_matchers_range_equals.hpp>
+
+#include <catch2/catch_get_random_seed.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <glm/gtc/type_ptr.hpp>
+
+#include <any>
+#include <tuple>
+
+#include <algorithm>
+#include <ranges>
+
+#include <cstdint>
+
+namespace Sampled = DisRegRep::Splatting::OccupancyConvolution::Sampled;
+namespace Splt = DisRegRep::Splatting;
+namespace RfGenExec = DisRegRep::RegionfieldGenerator::ExecutionPolicy;
+using DisRegRep::Splatting::OccupancyConvolution::Full::Vanilla,
+	DisRegRep::Container::Regionfield, DisRegRep::RegionfieldGenerator::Uniform;
+
+using Catch::Matchers::WithinAbs, Catch::Matchers::RangeEquals;
+
+using glm::make_vec2;
+
+using std::any, std::apply;
+using std::ranges::equal, std::ranges::for_each, std::ranges::max,
+	std::views::zip;
+
+SCENARIO("Look up stratified samples from a precomputed pattern table to compute region occupancy from a regionfield", "[Splatting][OccupancyConvolution][Sampled][TabulatedStratified]") {
+
+	GIVEN("A tabulated stratified sampled occupancy convolution and a plain stratified sampled occupancy convolution") {
+		Sampled::TabulatedStratified tabulated;
+		Sampled::Stratified stratified;
+
+		THEN("Splatting coefficient matrix is original") {
+			CHECK_FALSE(tabulated.isTransposed());
+		}
+
+		AND_GIVEN("A random regionfield and sampling parameters") {
+			const auto size = GENERATE(take(3U, chunk(2U, random<std::uint_least8_t>(1U, 6U))));
+			tabulated.Radius = stratified.Radius = size[0];
+			tabulated.StratumCount = stratified.StratumCount = size[1];
+			tabulated.Seed = stratified.Seed = Catch::getSeed();
+
+			const Splt::Base::InvokeInfo invoke_info {
+				.Offset = tabulated.minimumOffset(),
+				.Extent = make_vec2(GENERATE(take(2U, chunk(2U, random<std::uint_least8_t>(1U, 20U)))).data()),
+				//Both splattings emit sparse entries in order, so their outputs are compared as-is.
+				.Sorted = true
+			};
+			Regionfield rf;
+			rf.RegionCount = GENERATE(take(2U, random<Regionfield::ValueType>(1U, 10U)));
+			rf.resize(tabulated.minimumRegionfieldDimension(invoke_info));
+			static constexpr Uniform Generator;
+			Generator(RfGenExec::SingleThreadingTrait, rf, {
+				.Seed = Catch::getSeed()
+			});
+
+			WHEN("Pattern period exceeds the offset of every kernel") {
+				//Offset of kernels starts from zero, because the splatting starts from the minimum offset.
+				tabulated.PatternPeriod = max(invoke_info.Extent.x, invoke_info.Extent.y);
+
+				THEN("Splatting coefficients computed are identical to those of the plain stratified sampling") {
+					apply([&](const auto... trait) {
+						([&](const auto current_trait) {
+							any memory_tabulated, memory_stratified;
+							const auto& output_tabulated = tabulated(current_trait, invoke_info, rf, memory_tabulated);
+							const auto& output_stratified = stratified(current_trait, invoke_info, rf, memory_stratified);
+							CHECK_THAT(output_tabulated.range() | DisRegRep::Core::View::Functional::Dereference,
+								RangeEquals(output_stratified.range() | DisRegRep::Core::View::Functional::Dereference, equal));
+						}(trait), ...);
+					}, Splt::Container::Combination);
+				}
+
+			}
+
+		}
+
+		AND_GIVEN("One stratum for every element in the kernel") {
+			tabulated.Radius = GENERATE(values<Sampled::TabulatedStratified::KernelSizeType>({ 1U, 2U }));
+			tabulated.StratumCount = tabulated.diametre();
+			tabulated.PatternPeriod = GENERATE(values<Sampled::TabulatedStratified::KernelSizeType>({ 1U, 3U }));
+			tabulated.Seed = Catch::getSeed();
+
+			const Splt::Base::InvokeInfo invoke_info {
+				.Offset = tabulated.minimumOffset(),
+				.Extent = make_vec2(GENERATE(take(2U, chunk(2U, random<std::uint_least8_t>(1U, 12U)))).data())
+			};
+			Regionfield rf;
+			rf.RegionCount = GENERATE(take(2U, random<Regionfield::ValueType>(1U, 6U)));
+			rf.resize(tabulated.minimumRegionfieldDimension(invoke_info));
+			static constexpr Uniform Generator;
+			Generator(RfGenExec::SingleThreadingTrait, rf, {
+				.Seed = Catch::getSeed()
+			});
+
+			WHEN("It is invoked") {
+				Vanilla vanilla;
+				vanilla.Radius = tabulated.Radius;
+
+				any memory_tabulated, memory_vanilla;
+				const auto& sampled = tabulated(Splt::Container::DenseKernelDenseOutputTrait, invoke_info, rf, memory_tabulated);
+				const auto& exact = vanilla(Splt::Container::DenseKernelDenseOutputTrait, invoke_info, rf, memory_vanilla);
+
+				THEN("Every element is sampled exactly once regardless of the pattern period, so region masks are exact") {
+					for_each(zip(sampled.range(), exact.range()), [](const auto proxy) static {
+						const auto [sampled_proxy, exact_proxy] = proxy;
+						for_each(zip(*sampled_proxy, *exact_proxy), [](const auto mask) static {
+							const auto [sampled_mask, exact_mask] = mask;
+							CHECK_THAT(sampled_mask, WithinAbs(exact_mask, 1e-6F));
+						});
+					});
+				}
+
+			}
+
+		}
+
+	}
+
+}
\ No newline at end of file
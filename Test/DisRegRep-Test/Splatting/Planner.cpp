@@ -0,0 +1,146 @@
+#include <DisRegRep/Splatting/OccupancyConvolution/Full/Fast.hpp>
+#include <DisRegRep/Splatting/OccupancyConvolution/Full/Vanilla.hpp>
+#include <DisRegRep/Splatting/Planner.hpp>
+#include <DisRegRep/Splatting/Container.hpp>
+
+#include <DisRegRep/Core/System/Processor.hpp>
+
+#include <catch2/matchers/catch_matchers_string.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <span>
+#include <string>
+
+#include <algorithm>
+
+#include <sstream>
+
+#include <tuple>
+
+namespace OccCnv = DisRegRep::Splatting::OccupancyConvolution;
+namespace Splt = DisRegRep::Splatting;
+namespace Processor = DisRegRep::Core::System::Processor;
+using DisRegRep::Splatting::Planner,
+	OccCnv::Full::Fast, OccCnv::Full::Vanilla;
+
+using Catch::Matchers::ContainsSubstring;
+
+using std::array, std::span, std::string,
+	std::istringstream, std::ostringstream;
+using std::ranges::contains, std::ranges::count;
+using std::tuple_size_v;
+
+SCENARIO("Plan the fastest splatting for a problem and remember it as wisdom", "[Splatting][Planner]") {
+
+	GIVEN("No candidate") {
+
+		THEN("Planner cannot be created") {
+			CHECK_THROWS_WITH(Planner(span<OccCnv::Base* const> {}), ContainsSubstring("empty"));
+		}
+
+	}
+
+	GIVEN("A planner with some candidates") {
+		Vanilla vanilla;
+		Fast fast;
+		const auto candidate = array<OccCnv::Base*, 2U> { &vanilla, &fast };
+		Planner planner(candidate);
+		planner.ProbeExtent = Planner::DimensionType(16U);
+		planner.ProbeRepetition = 1U;
+
+		static constexpr Planner::KernelSizeType Radius = 3U;
+		static constexpr Planner::RegionCountType RegionCount = 5U;
+		const Splt::Base::InvokeInfo invoke_info {
+			.Offset = Planner::DimensionType(Radius),
+			.Extent = Planner::DimensionType(40U, 30U)
+		};
+
+		THEN("Problems of similar size share the same key") {
+			const Splt::Base::InvokeInfo similar_info {
+				.Offset = invoke_info.Offset,
+				.Extent = Planner::DimensionType(32U, 36U)
+			};
+			CHECK(Planner::makeKey(invoke_info, Radius, RegionCount) == Planner::makeKey(similar_info, Radius, RegionCount));
+			CHECK(Planner::makeKey(invoke_info, Radius, RegionCount) != Planner::makeKey(invoke_info, 4U * Radius, RegionCount));
+			CHECK(Planner::makeKey(invoke_info, Radius, RegionCount) != Planner::makeKey(invoke_info, Radius, 4U * RegionCount));
+		}
+
+		WHEN("Nothing is timed when probing") {
+			planner.ProbeRepetition = 0U;
+
+			THEN("No candidate can be chosen") {
+				CHECK_THROWS_WITH(planner(invoke_info, Radius, RegionCount), ContainsSubstring("ProbeRepetition"));
+			}
+
+		}
+
+		WHEN("A plan is made for a problem") {
+			const Planner::Plan plan = planner(invoke_info, Radius, RegionCount);
+
+			THEN("One of the candidates and container traits is chosen, whose radius is that of the problem") {
+				REQUIRE(contains(candidate, plan.Splatting));
+				CHECK(plan.Splatting->Radius == Radius);
+				CHECK(plan.ContainerTrait < tuple_size_v<Splt::Container::CombinationType>);
+			}
+
+			AND_WHEN("A plan is made again for a problem of similar size") {
+				//Probing would fail, so the plan can only come from wisdom.
+				planner.ProbeRepetition = 0U;
+				const Planner::Plan plan_again = planner(invoke_info, Radius, RegionCount);
+
+				THEN("The same plan is returned from wisdom") {
+					CHECK(plan_again.Splatting == plan.Splatting);
+					CHECK(plan_again.ContainerTrait == plan.ContainerTrait);
+				}
+
+			}
+
+			AND_WHEN("Wisdom is exported and imported to another planner") {
+				ostringstream output;
+				planner.exportWisdom(output);
+				const string wisdom = output.str();
+
+				Planner planner_imported(candidate);
+				auto input = istringstream(wisdom);
+				planner_imported.importWisdom(input);
+				planner_imported.ProbeRepetition = 0U;
+
+				THEN("Wisdom has one entry per problem") {
+					CHECK(count(wisdom, '\n') == 1);
+				}
+
+				THEN("The imported planner returns the same plan without probing") {
+					const Planner::Plan plan_imported = planner_imported(invoke_info, Radius, RegionCount);
+					CHECK(plan_imported.Splatting == plan.Splatting);
+					CHECK(plan_imported.ContainerTrait == plan.ContainerTrait);
+				}
+
+			}
+
+		}
+
+		WHEN("Wisdom of a different processor model is imported") {
+			auto input = istringstream(string("Not A Processor\t2\t3\t11\t") + string(fast.name()) + "\tDD\n");
+			planner.importWisdom(input);
+			planner.ProbeRepetition = 0U;
+
+			THEN("Wisdom is ignored") {
+				CHECK_THROWS_WITH(planner(invoke_info, Radius, RegionCount), ContainsSubstring("ProbeRepetition"));
+			}
+
+		}
+
+		WHEN("Malformed wisdom is imported") {
+			auto input = istringstream(Processor::getModelName() + "\tNot A Number\n");
+
+			THEN("It is rejected") {
+				CHECK_THROWS(planner.importWisdom(input));
+			}
+
+		}
+
+	}
+
+}
\ No newline at end of file
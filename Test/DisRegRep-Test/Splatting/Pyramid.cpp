@@ -0,0 +1,133 @@
+#include <DisRegRep/Splatting/OccupancyConvolution/Full/Vanilla.hpp>
+#include <DisRegRep/Splatting/Pyramid.hpp>
+
+#include <DisRegRep/Container/Regionfield.hpp>
+
+#include <DisRegRep/RegionfieldGenerator/ExecutionPolicy.hpp>
+#include <DisRegRep/RegionfieldGenerator/Uniform.hpp>
+
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <catch2/catch_get_random_seed.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <glm/common.hpp>
+
+#include <vector>
+
+#include <any>
+
+#include <algorithm>
+#include <functional>
+#include <ranges>
+
+#include <bit>
+
+namespace RfGenExec = DisRegRep::RegionfieldGenerator::ExecutionPolicy;
+namespace Splt = DisRegRep::Splatting;
+using DisRegRep::Splatting::Pyramid, DisRegRep::Splatting::OccupancyConvolution::Full::Vanilla,
+	DisRegRep::Container::Regionfield, DisRegRep::RegionfieldGenerator::Uniform;
+
+using Catch::Matchers::WithinAbs;
+
+using std::vector,
+	std::any;
+using std::ranges::for_each, std::ranges::fill,
+	std::plus,
+	std::views::cartesian_product, std::views::enumerate, std::views::iota, std::views::zip;
+using std::has_single_bit;
+
+namespace {
+
+using Dimension2Type = Pyramid::MaskType::Dimension2Type;
+using Dimension3Type = Pyramid::MaskType::Dimension3Type;
+using ValueType = Pyramid::MaskType::ValueType;
+
+}
+
+SCENARIO("Reduce region masks to a chain of successively coarser levels", "[Splatting][Pyramid]") {
+
+	GIVEN("A splatting and a random regionfield") {
+		Vanilla splatting;
+		splatting.Radius = 2U;
+		const Splt::Base::InvokeInfo invoke_info {
+			.Offset = splatting.minimumOffset(),
+			.Extent = GENERATE(values<Splt::Base::DimensionType>({
+				{ 8U, 4U }, { 2U, 16U }, { 5U, 3U }, { 1U, 7U }
+			}))
+		};
+
+		Regionfield rf;
+		rf.RegionCount = 5U;
+		rf.resize(splatting.minimumRegionfieldDimension(invoke_info));
+		static constexpr Uniform Generator;
+		Generator(RfGenExec::SingleThreadingTrait, rf, {
+			.Seed = Catch::getSeed()
+		});
+
+		Pyramid pyramid;
+		any memory;
+
+		WHEN("Reduced levels are built from the splatting output") {
+			const Pyramid::MaskType& base = pyramid(splatting, invoke_info, rf, memory);
+			const Dimension3Type base_extent = base.extent();
+			const auto level = pyramid.level();
+
+			THEN("Every level halves the extent of its previous level, rounding up, until an extent of one is reached") {
+				auto expected_extent = Dimension2Type(base_extent);
+				for_each(level, [&expected_extent, &base_extent](const auto& reduced) {
+					expected_extent = (expected_extent + 1U) / 2U;
+					CHECK(Dimension3Type(reduced.extent()) == Dimension3Type(expected_extent, base_extent.z));
+				});
+				CHECK(expected_extent == Dimension2Type(1U));
+			}
+
+			THEN("Region masks of every level are the box average of the base level") {
+				//A level is reduced from its previous level, which is only the same as reducing from the base level when every box of the
+				//	previous level covers the same number of elements on the base level.
+				const bool power_of_two = has_single_bit(base_extent.x) && has_single_bit(base_extent.y);
+				const auto base_matrix = base.range2d();
+				auto expected = vector<ValueType>(base_extent.z);
+				for (const auto [index, reduced] : level | enumerate) {
+					if (index > 0 && !power_of_two) {
+						break;
+					}
+					const auto box = Dimension2Type(Dimension2Type::value_type { 1U } << (index + 1));
+					const Dimension2Type reduced_extent = reduced.extent();
+					const auto reduced_matrix = reduced.range2d();
+					for (const auto [x, y] : cartesian_product(iota(Dimension2Type::value_type {}, reduced_extent.x),
+						iota(Dimension2Type::value_type {}, reduced_extent.y))) {
+						const Dimension2Type first = Dimension2Type(x, y) * box,
+							last = glm::min(first + box, Dimension2Type(base_extent)),
+							box_extent = last - first;
+
+						fill(expected, ValueType {});
+						for_each(cartesian_product(iota(first.x, last.x), iota(first.y, last.y)), [&base_matrix, &expected](const auto coordinate) {
+							const auto [i, j] = coordinate;
+							std::ranges::transform(expected, *base_matrix[i][j], expected.begin(), plus {});
+						});
+						const auto area = static_cast<ValueType>(box_extent.x * box_extent.y);
+						for_each(zip(*reduced_matrix[x][y], expected), [area](const auto mask) {
+							const auto [actual, sum] = mask;
+							CHECK_THAT(actual, WithinAbs(sum / area, 1e-6F));
+						});
+					}
+				}
+			}
+
+		}
+
+		WHEN("The number of levels is limited") {
+			pyramid.MaximumLevel = 1U;
+			static_cast<void>(pyramid(splatting, invoke_info, rf, memory));
+
+			THEN("No more than the maximum number of levels are built") {
+				CHECK(pyramid.level().size() == 1U);
+			}
+
+		}
+
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,178 @@
+#include <DisRegRep/Splatting/OccupancyConvolution/Full/Vanilla.hpp>
+#include <DisRegRep/Splatting/Container.hpp>
+#include <DisRegRep/Splatting/Transfer.hpp>
+
+#include <DisRegRep/Container/Regionfield.hpp>
+#include <DisRegRep/Core/MdSpan.hpp>
+#include <DisRegRep/Core/Type.hpp>
+
+#include <DisRegRep/RegionfieldGenerator/ExecutionPolicy.hpp>
+#include <DisRegRep/RegionfieldGenerator/Uniform.hpp>
+
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include <catch2/matchers/catch_matchers_string.hpp>
+
+#include <catch2/catch_get_random_seed.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <vector>
+
+#include <any>
+
+#include <algorithm>
+#include <ranges>
+
+#include <concepts>
+#include <limits>
+
+#include <cstdint>
+
+namespace MdSpan = DisRegRep::Core::MdSpan;
+namespace RfGenExec = DisRegRep::RegionfieldGenerator::ExecutionPolicy;
+namespace Splt = DisRegRep::Splatting;
+namespace Transfer = DisRegRep::Splatting::Transfer;
+using DisRegRep::Splatting::OccupancyConvolution::Full::Vanilla,
+	DisRegRep::Container::Regionfield, DisRegRep::RegionfieldGenerator::Uniform,
+	DisRegRep::Core::Type::RegionMask;
+
+using Catch::Matchers::WithinAbs, Catch::Matchers::ContainsSubstring;
+
+using std::vector,
+	std::any;
+using std::ranges::for_each,
+	std::views::cartesian_product, std::views::enumerate, std::views::iota;
+using std::numeric_limits;
+
+namespace {
+
+//Tolerance of a decoded region mask, which is half of the quantisation step for an integer.
+template<Transfer::Value V>
+constexpr double Tolerance = std::floating_point<V> ? 0.0 : 0.5 / numeric_limits<V>::max() + 1e-6;
+
+template<Transfer::Value V>
+[[nodiscard]] constexpr double decode(const V value) noexcept {
+	if constexpr (std::floating_point<V>) {
+		return value;
+	} else {
+		return static_cast<double>(value) / numeric_limits<V>::max();
+	}
+}
+
+}
+
+TEMPLATE_TEST_CASE("Region masks are encoded to the full range of the value type", "[Splatting][Transfer]",
+	float, std::uint8_t, std::uint16_t, std::uint32_t) {
+	using ValueType = TestType;
+
+	CHECK(Transfer::encode<ValueType>(0.0F) == ValueType {});
+	if constexpr (std::floating_point<ValueType>) {
+		CHECK(Transfer::encode<ValueType>(0.25F) == 0.25F);
+	} else {
+		static constexpr ValueType Maximum = numeric_limits<ValueType>::max();
+		CHECK(Transfer::encode<ValueType>(1.0F) == Maximum);
+		//Rounding error of a region mask must not overflow the value type.
+		CHECK(Transfer::encode<ValueType>(1.0F + numeric_limits<RegionMask>::epsilon()) == Maximum);
+		CHECK(Transfer::encode<ValueType>(-numeric_limits<RegionMask>::epsilon()) == ValueType {});
+		CHECK(Transfer::encode<ValueType>(0.5F) == static_cast<ValueType>(Maximum / 2U + 1U));
+	}
+}
+
+TEMPLATE_TEST_CASE("Region masks are transferred to a caller-provided buffer from dense and sparse containers", "[Splatting][Transfer]",
+	float, std::uint8_t, std::uint16_t, std::uint32_t) {
+	using ValueType = TestType;
+
+	GIVEN("A splatting and a random regionfield") {
+		Vanilla splatting;
+		splatting.Radius = 2U;
+		const Splt::Base::InvokeInfo invoke_info {
+			.Offset = splatting.minimumOffset(),
+			.Extent = Splt::Base::DimensionType(7U, 5U)
+		};
+
+		Regionfield rf;
+		rf.RegionCount = 6U;
+		rf.resize(splatting.minimumRegionfieldDimension(invoke_info));
+		static constexpr Uniform Generator;
+		Generator(RfGenExec::SingleThreadingTrait, rf, {
+			.Seed = Catch::getSeed()
+		});
+
+		any memory_exact;
+		const auto& exact = splatting(Splt::Container::DenseKernelDenseOutputTrait, invoke_info, rf, memory_exact);
+		const auto exact_matrix = exact.range2d();
+
+		const Transfer::IndexType width = invoke_info.Extent.x, height = invoke_info.Extent.y, region_count = rf.RegionCount;
+		auto buffer = vector<ValueType>(width * height * region_count);
+		const auto output = Transfer::OutputType<ValueType>(buffer.data(), width, height, region_count);
+
+		const auto check = [&] {
+			for (const auto [x, y] : cartesian_product(iota(Transfer::IndexType {}, width), iota(Transfer::IndexType {}, height))) {
+				for (const auto [region, expected] : *exact_matrix[x][y] | enumerate) {
+					CHECK_THAT(decode(output[x, y, static_cast<Transfer::IndexType>(region)]), WithinAbs(expected, Tolerance<ValueType>));
+				}
+			}
+		};
+
+		WHEN("Region masks of a dense container are transferred") {
+			any memory;
+			Transfer::splat(splatting, Splt::Container::DenseKernelDenseOutputTrait, invoke_info, rf, memory, output);
+
+			THEN("Every region mask is decoded to the exact one") {
+				check();
+			}
+
+		}
+
+		WHEN("Region masks of a sparse container are transferred to a buffer with stale values") {
+			for_each(buffer, [](auto& value) static { value = numeric_limits<ValueType>::max(); });
+			any memory;
+			Transfer::splat(splatting, Splt::Container::DenseKernelSparseOutputTrait, invoke_info, rf, memory, output);
+
+			THEN("Every region mask is decoded to the exact one, and absent regions are zeros") {
+				check();
+			}
+
+		}
+
+		WHEN("Region masks are transferred to a buffer with a blocked layout") {
+			using BlockedLayout = MdSpan::LayoutBlocked<4U>;
+			const BlockedLayout::mapping<Transfer::ExtentType> blocked_mapping(Transfer::ExtentType(width, height, region_count));
+			auto buffer_blocked = vector<ValueType>(blocked_mapping.required_span_size());
+			const auto output_blocked = Transfer::OutputType<ValueType, BlockedLayout>(buffer_blocked.data(), blocked_mapping);
+			any memory;
+			Transfer::splat(splatting, Splt::Container::DenseKernelDenseOutputTrait, invoke_info, rf, memory, output);
+			Transfer::splat(splatting, Splt::Container::DenseKernelDenseOutputTrait, invoke_info, rf, memory, output_blocked);
+
+			THEN("It has the same content as a row-major buffer") {
+				for (const auto [x, y, region] : cartesian_product(iota(Transfer::IndexType {}, width),
+					iota(Transfer::IndexType {}, height), iota(Transfer::IndexType {}, region_count))) {
+					CHECK(output_blocked[x, y, region] == output[x, y, region]);
+				}
+			}
+
+		}
+
+		WHEN("The buffer has more regions than the regionfield") {
+			auto buffer_large = vector<ValueType>(width * height * (region_count + 1U));
+			const auto output_large = Transfer::OutputType<ValueType>(buffer_large.data(), width, height, region_count + 1U);
+			any memory;
+
+			THEN("Dense region masks are rejected") {
+				CHECK_THROWS_WITH(
+					Transfer::splat(splatting, Splt::Container::DenseKernelDenseOutputTrait, invoke_info, rf, memory, output_large),
+					ContainsSubstring("RegionCount"));
+			}
+
+			THEN("Sparse region masks are accepted, and the extra region is zero") {
+				Transfer::splat(splatting, Splt::Container::DenseKernelSparseOutputTrait, invoke_info, rf, memory, output_large);
+				for (const auto [x, y] : cartesian_product(iota(Transfer::IndexType {}, width), iota(Transfer::IndexType {}, height))) {
+					CHECK(output_large[x, y, region_count] == ValueType {});
+				}
+			}
+
+		}
+
+	}
+
+}
\ No newline at end of file